@@ -0,0 +1,447 @@
+#include <stdio.h>
+#include <chrono>
+
+#include "../src/pax_defs.hpp"
+#include "../src/pax_base.hpp"
+#include "../src/pax_system.hpp"
+
+using namespace pax;
+
+//
+// Types
+//
+
+typedef struct {
+    const char* name;
+    isize       ascii;
+    u32         lower;
+    u32         upper;
+} Bench_Corpus;
+
+typedef struct {
+    String_8   utf8;
+    String_16  utf16;
+    String_32  utf32;
+    Mem_Arena* arena;
+    isize      marker;
+    isize      sink;
+} Bench_Input;
+
+typedef void (*Bench_Proc)(Bench_Input* input);
+
+//
+// Values
+//
+
+static const isize BENCH_BYTES = 8 * 1024 * 1024;
+static const f64   BENCH_TIME  = 0.25;
+
+static const Bench_Corpus BENCH_CORPORA[] = {
+    {"ascii", 99, 0x000a0, 0x000ff},
+    {"cjk",   10, 0x04e00, 0x09fff},
+    {"emoji", 40, 0x1f300, 0x1faff},
+};
+
+static const Bench_Corpus BENCH_MIXED = {"mixed", 85, 0x000a0, 0x000ff};
+
+//
+// Procs
+//
+
+u64 bench_random(u64* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+
+    return *state;
+}
+
+f64 bench_now()
+{
+    auto time = std::chrono::steady_clock::now().time_since_epoch();
+
+    return std::chrono::duration<f64>(time).count();
+}
+
+String_8 bench_corpus(Bench_Corpus corpus, isize bytes, Mem_Arena* arena)
+{
+    String_8 result = {};
+
+    Mem_Block block = arena_push_uninit(arena, bytes, 1);
+
+    if (block.memory == 0) return result;
+
+    result.memory = block.memory;
+
+    u64 state = 0x9e3779b97f4a7c15;
+
+    while (result.length < bytes - 4) {
+        u64 value = bench_random(&state);
+        u32 point = (u32)(0x20 + (value >> 8) % 0x5f);
+
+        if ((isize)(value % 100) >= corpus.ascii)
+            point = corpus.lower + (u32)((value >> 32) % (corpus.upper - corpus.lower + 1));
+
+        UTF_Result encode = str8_encode({block.memory, bytes}, result.length, point);
+
+        result.length += encode.units;
+    }
+
+    return result;
+}
+
+f64 bench_run(Bench_Proc proc, Bench_Input* input, isize bytes)
+{
+    f64   best  = 0;
+    f64   start = bench_now();
+    isize loops = 0;
+
+    while (loops < 3 || bench_now() - start < BENCH_TIME) {
+        f64 time = bench_now();
+
+        proc(input);
+
+        time = bench_now() - time;
+
+        if (loops == 0 || time < best) best = time;
+
+        loops += 1;
+    }
+
+    return (f64)(bytes) / best / 1e9;
+}
+
+void bench_report(const char* name, const char* corpus, f64 scalar, f64 result)
+{
+    printf("%-20s %-6s scalar %6.2f GB/s   pax %6.2f GB/s   %5.1fx\n",
+        name, corpus, scalar, result, result / scalar);
+}
+
+void bench_compare(const char* name, const char* corpus, Bench_Proc scalar, Bench_Proc proc, Bench_Input* input, isize bytes)
+{
+    f64 before = bench_run(scalar, input, bytes);
+    f64 after  = bench_run(proc, input, bytes);
+
+    bench_report(name, corpus, before, after);
+}
+
+isize bench_str8_count_as_utf32_scalar(String_8 self)
+{
+    isize result = 0;
+    isize index  = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str8_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) return -1;
+
+        result += 1;
+        index  += decode.units;
+    }
+
+    return result;
+}
+
+isize bench_str16_count_as_utf8_scalar(String_16 self)
+{
+    isize result = 0;
+    isize index  = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str16_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) return -1;
+
+        result += utf8_get_units(decode.value);
+        index  += decode.units;
+    }
+
+    return result;
+}
+
+isize bench_str32_count_as_utf8_scalar(String_32 self)
+{
+    isize result = 0;
+    isize index  = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str32_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) return -1;
+
+        result += utf8_get_units(decode.value);
+        index  += decode.units;
+    }
+
+    return result;
+}
+
+bool bench_str8_to_utf32_scalar(String_8 self, String_32* string, Mem_Arena* arena)
+{
+    String_32 result = {};
+
+    isize marker = arena->offset;
+
+    Mem_Block block = arena_push_array(arena, self.length + 1,
+        PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32));
+
+    if (block.memory == 0) return false;
+
+    result.memory = (u32*)(block.memory);
+    result.length = self.length;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str8_decode(self, index);
+        UTF_Result encode = str32_encode(result, other, decode.value);
+
+        if (decode.error != UTF_ERROR_NONE || encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+bool bench_str32_to_utf8_scalar(String_32 self, String_8* string, Mem_Arena* arena)
+{
+    String_8 result = {};
+
+    isize marker = arena->offset;
+
+    Mem_Block block = arena_push_uninit(arena, self.length * 4 + 1, 1);
+
+    if (block.memory == 0) return false;
+
+    result.memory = block.memory;
+    result.length = self.length * 4;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str32_decode(self, index);
+        UTF_Result encode = str8_encode(result, other, decode.value);
+
+        if (decode.error != UTF_ERROR_NONE || encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+bool bench_str16_to_utf8_scalar(String_16 self, String_8* string, Mem_Arena* arena)
+{
+    String_8 result = {};
+
+    isize marker = arena->offset;
+    isize units  = 0;
+    isize index  = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str16_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) return false;
+
+        units += utf8_get_units(decode.value);
+        index += decode.units;
+    }
+
+    Mem_Block block = arena_push_uninit(arena, units + 1, 1);
+
+    if (block.memory == 0) return false;
+
+    result.memory = block.memory;
+    result.length = units;
+
+    isize other = 0;
+
+    index = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = str16_decode(self, index);
+        UTF_Result encode = str8_encode(result, other, decode.value);
+
+        if (decode.error != UTF_ERROR_NONE || encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    *string = result;
+
+    return true;
+}
+
+void bench_str16_to_utf8_old(Bench_Input* input)
+{
+    String_8 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += bench_str16_to_utf8_scalar(input->utf16, &result, input->arena);
+}
+
+void bench_str16_to_utf8_new(Bench_Input* input)
+{
+    String_8 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += str16_to_utf8(input->utf16, &result, input->arena);
+}
+
+void bench_str8_count_as_utf32_old(Bench_Input* input)
+{
+    input->sink += bench_str8_count_as_utf32_scalar(input->utf8);
+}
+
+void bench_str8_count_as_utf32_new(Bench_Input* input)
+{
+    input->sink += str8_count_as_utf32(input->utf8);
+}
+
+void bench_str16_count_as_utf8_old(Bench_Input* input)
+{
+    input->sink += bench_str16_count_as_utf8_scalar(input->utf16);
+}
+
+void bench_str16_count_as_utf8_new(Bench_Input* input)
+{
+    input->sink += str16_count_as_utf8(input->utf16);
+}
+
+void bench_str32_count_as_utf8_old(Bench_Input* input)
+{
+    input->sink += bench_str32_count_as_utf8_scalar(input->utf32);
+}
+
+void bench_str32_count_as_utf8_new(Bench_Input* input)
+{
+    input->sink += str32_count_as_utf8(input->utf32);
+}
+
+void bench_str8_to_utf32_old(Bench_Input* input)
+{
+    String_32 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += bench_str8_to_utf32_scalar(input->utf8, &result, input->arena);
+}
+
+void bench_str8_to_utf32_new(Bench_Input* input)
+{
+    String_32 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += str8_to_utf32(input->utf8, &result, input->arena);
+}
+
+void bench_str32_to_utf8_old(Bench_Input* input)
+{
+    String_8 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += bench_str32_to_utf8_scalar(input->utf32, &result, input->arena);
+}
+
+void bench_str32_to_utf8_new(Bench_Input* input)
+{
+    String_8 result = {};
+
+    arena_pop(input->arena, input->marker);
+
+    input->sink += str32_to_utf8(input->utf32, &result, input->arena);
+}
+
+int main()
+{
+    Mem_Arena arena = {};
+
+    arena_init_chain(&arena, BENCH_BYTES * 16, 2, system_acquire, system_release);
+
+    isize count = PAX_ARRAY_ITEMS(BENCH_CORPORA);
+
+    for (isize i = 0; i < count; i += 1) {
+        Bench_Input input = {};
+
+        input.arena = &arena;
+        input.utf8  = bench_corpus(BENCH_CORPORA[i], BENCH_BYTES, &arena);
+
+        if (str8_to_utf16(input.utf8, &input.utf16, &arena) == false)
+            return 1;
+
+        input.marker = arena.offset;
+
+        bench_compare("str16_to_utf8", BENCH_CORPORA[i].name,
+            bench_str16_to_utf8_old, bench_str16_to_utf8_new,
+            &input, input.utf16.length * PAX_SIZE_OF(u16));
+
+        arena_clear(&arena);
+    }
+
+    Bench_Input input = {};
+
+    input.arena = &arena;
+    input.utf8  = bench_corpus(BENCH_MIXED, BENCH_BYTES, &arena);
+
+    if (str8_to_utf16(input.utf8, &input.utf16, &arena) == false)
+        return 1;
+
+    if (str8_to_utf32(input.utf8, &input.utf32, &arena) == false)
+        return 1;
+
+    input.marker = arena.offset;
+
+    isize bytes_8  = input.utf8.length;
+    isize bytes_16 = input.utf16.length * PAX_SIZE_OF(u16);
+    isize bytes_32 = input.utf32.length * PAX_SIZE_OF(u32);
+
+    bench_compare("str8_count_as_utf32", BENCH_MIXED.name,
+        bench_str8_count_as_utf32_old, bench_str8_count_as_utf32_new, &input, bytes_8);
+
+    bench_compare("str16_count_as_utf8", BENCH_MIXED.name,
+        bench_str16_count_as_utf8_old, bench_str16_count_as_utf8_new, &input, bytes_16);
+
+    bench_compare("str32_count_as_utf8", BENCH_MIXED.name,
+        bench_str32_count_as_utf8_old, bench_str32_count_as_utf8_new, &input, bytes_32);
+
+    bench_compare("str8_to_utf32", BENCH_MIXED.name,
+        bench_str8_to_utf32_old, bench_str8_to_utf32_new, &input, bytes_8);
+
+    bench_compare("str32_to_utf8", BENCH_MIXED.name,
+        bench_str32_to_utf8_old, bench_str32_to_utf8_new, &input, bytes_32);
+
+    arena_clear(&arena);
+}
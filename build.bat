@@ -1,3 +1,11 @@
 @echo off
 
 zig c++ src/main.cpp src/pax_base.cpp src/pax_system.cpp
+zig c++ test/test_arena.cpp src/pax_base.cpp src/pax_system.cpp -o test_arena.exe
+zig c++ -DPAX_SIMD=0 test/test_utf.cpp src/pax_base.cpp src/pax_system.cpp -o test_utf_none.exe
+zig c++ -DPAX_SIMD=1 -msse4.1 test/test_utf.cpp src/pax_base.cpp src/pax_system.cpp -o test_utf_sse4.exe
+zig c++ -DPAX_SIMD=2 -mavx2 test/test_utf.cpp src/pax_base.cpp src/pax_system.cpp -o test_utf_avx2.exe
+zig c++ -DPAX_SIMD=0 test/test_text.cpp src/pax_base.cpp src/pax_system.cpp -o test_text_none.exe
+zig c++ -DPAX_SIMD=1 -msse4.1 test/test_text.cpp src/pax_base.cpp src/pax_system.cpp -o test_text_sse4.exe
+zig c++ -DPAX_SIMD=2 -mavx2 test/test_text.cpp src/pax_base.cpp src/pax_system.cpp -o test_text_avx2.exe
+zig c++ -O2 bench/bench_utf.cpp src/pax_base.cpp src/pax_system.cpp -o bench_utf.exe
@@ -13,7 +13,7 @@ int main()
     String_8    name   = PAX_STR_8("README.md");
     File_Handle handle = {};
 
-    arena_init(&arena, system_reserve(4));
+    arena_init_chain(&arena, system_get_page_size() * 4, 2, system_acquire, system_release);
 
     File_Error error = file_open_to_read(&handle, name, &arena);
 
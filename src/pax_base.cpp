@@ -1,7 +1,160 @@
 #include "pax_base.hpp"
 
+#if PAX_SIMD == PAX_SIMD_SSE4
+
+    #include "pax_simd_sse4.cpp"
+
+#elif PAX_SIMD == PAX_SIMD_AVX2
+
+    #include "pax_simd_avx2.cpp"
+
+#elif PAX_SIMD == PAX_SIMD_NEON
+
+    #include "pax_simd_neon.cpp"
+
+#endif
+
+#if PAX_COMP == PAX_COMP_MSVC
+
+    #include <intrin.h>
+
+#endif
+
 namespace pax {
 
+isize bits_count_trailing(u64 value)
+{
+    if (value == 0) return 64;
+
+#if PAX_COMP == PAX_COMP_MSVC
+
+    unsigned long index = 0;
+
+    if (_BitScanForward(&index, (unsigned long)(value)) == 0) {
+        _BitScanForward(&index, (unsigned long)(value >> 32));
+
+        index += 32;
+    }
+
+    return index;
+
+#else
+
+    return __builtin_ctzll(value);
+
+#endif
+}
+
+isize bits_count_leading(u64 value)
+{
+    if (value == 0) return 64;
+
+#if PAX_COMP == PAX_COMP_MSVC
+
+    unsigned long index = 0;
+
+    if (_BitScanReverse(&index, (unsigned long)(value >> 32)) != 0)
+        return 31 - index;
+
+    _BitScanReverse(&index, (unsigned long)(value));
+
+    return 63 - index;
+
+#else
+
+    return __builtin_clzll(value);
+
+#endif
+}
+
+isize bits_count_ones(u64 value)
+{
+#if PAX_COMP == PAX_COMP_MSVC
+
+    value = value - ((value >> 1) & 0x5555555555555555);
+    value = (value & 0x3333333333333333) + ((value >> 2) & 0x3333333333333333);
+    value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0f;
+
+    return (value * 0x0101010101010101) >> 56;
+
+#else
+
+    return __builtin_popcountll(value);
+
+#endif
+}
+
+u64 bits_load_u64(u8* memory)
+{
+    return ((u64)(memory[0]) <<  0) | ((u64)(memory[1]) <<  8) |
+           ((u64)(memory[2]) << 16) | ((u64)(memory[3]) << 24) |
+           ((u64)(memory[4]) << 32) | ((u64)(memory[5]) << 40) |
+           ((u64)(memory[6]) << 48) | ((u64)(memory[7]) << 56);
+}
+
+u64 bits_find_zero(u64 value)
+{
+    return (value - 0x0101010101010101) & ~value & 0x8080808080808080;
+}
+
+u32 bits_load_u32(u8* memory)
+{
+    return ((u32)(memory[0]) <<  0) | ((u32)(memory[1]) <<  8) |
+           ((u32)(memory[2]) << 16) | ((u32)(memory[3]) << 24);
+}
+
+f64 bits_to_f64(u64 value)
+{
+    f64 result = 0;
+    u8* memory = PAX_U8_PTR(&result);
+
+    for (isize i = 0; i < 8; i += 1)
+        memory[i] = (u8)(value >> (i * 8));
+
+    return result;
+}
+
+u64 bits_from_f64(f64 value)
+{
+    return bits_load_u64(PAX_U8_PTR(&value));
+}
+
+u64 bits_mul_u128(u64 value, u64 other, u64* high)
+{
+#if PAX_COMP == PAX_COMP_MSVC && _M_X64
+
+    return _umul128(value, other, high);
+
+#elif PAX_COMP == PAX_COMP_MSVC && _M_ARM64
+
+    *high = __umulh(value, other);
+
+    return value * other;
+
+#elif __SIZEOF_INT128__
+
+    unsigned __int128 result = (unsigned __int128)(value) * other;
+
+    *high = (u64)(result >> 64);
+
+    return (u64)(result);
+
+#else
+
+    u64 low_low   = (value & 0xffffffff) * (other & 0xffffffff);
+    u64 high_low  = (value >> 32)        * (other & 0xffffffff);
+    u64 low_high  = (value & 0xffffffff) * (other >> 32);
+    u64 high_high = (value >> 32)        * (other >> 32);
+
+    u64 cross = (low_low >> 32) + (high_low & 0xffffffff) + low_high;
+
+    *high = high_high + (high_low >> 32) + (cross >> 32);
+
+    return (cross << 32) | (low_low & 0xffffffff);
+
+#endif
+}
+
 bool unicode_is_valid(u32 value)
 {
     return (value >= 0x0    && value < 0xd800) ||
@@ -75,13 +228,63 @@ bool str8_init(String_8* self, u8* value, isize limit)
         return true;
     }
 
+    isize stop = PAX_MAX(limit, 0);
+
+#if PAX_ASAN
+
     while (value[length] != 0) {
-        if (length >= limit)
+        if (length >= stop)
             return false;
 
         length += 1;
     }
 
+#elif PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 zero   = simd_splat(0);
+    isize   skip   = (isize)((u64)(value) & (SIMD_WIDTH - 1));
+    u8*     memory = PAX_U8_PTR(value) - skip;
+    isize   offset = -skip;
+
+    u64 mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+    mask = mask >> skip << skip;
+
+    while (mask == 0) {
+        memory += SIMD_WIDTH;
+        offset += SIMD_WIDTH;
+
+        if (offset > stop) return false;
+
+        mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+    }
+
+    length = (offset + bits_count_trailing(mask));
+
+#else
+
+    isize skip   = (isize)((u64)(value) & 7);
+    u8*   memory = PAX_U8_PTR(value) - skip;
+    isize offset = -skip;
+    u64   word   = bits_load_u64(memory) | (((u64)(1) << (skip * 8)) - 1);
+
+    u64 mask = (word - 0x0101010101010101) & ~word & 0x8080808080808080;
+
+    while (mask == 0) {
+        memory += 8;
+        offset += 8;
+
+        if (offset > stop) return false;
+
+        word = bits_load_u64(memory);
+        mask = (word - 0x0101010101010101) & ~word & 0x8080808080808080;
+    }
+
+    length = (offset + bits_count_trailing(mask) / 8);
+
+#endif
+
+    if (length > stop) return false;
+
     self->memory = value;
     self->length = length;
 
@@ -141,339 +344,481 @@ UTF_Result str8_encode(String_8 self, isize index, u32 value)
     return result;
 }
 
+static const u8 UTF8_DFA_CLASS[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  2,
+     3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,
+     6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  7,  6,  6,
+     8,  9,  9,  9, 10, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12,
+};
+
+static const u8 UTF8_DFA_UNITS[14] = {
+    1, 0, 0, 0, 0, 2, 3, 3, 4, 4, 4, 4, 0, 0,
+};
+
+static const u8 UTF8_DFA_MASK[14] = {
+    0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00,
+};
+
+static const u8 UTF8_DFA_STATE[16][14] = {
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+    { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    { 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3},
+    { 4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4},
+    { 2,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  5,  5,  5,  5,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  6,  6,  6,  6,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  8,  8,  8,  8,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  9,  9,  9,  9,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  5,  5,  5,  8,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2, 13,  6,  6,  6,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  5,  5,  5,  8,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 2,  6,  6,  9,  9,  2,  2,  2,  2,  2,  2,  2,  2,  3},
+    { 0,  4,  4,  4,  4,  5,  6, 11, 12,  7, 14, 10,  4,  3},
+};
+
+static const UTF_Error UTF8_DFA_ERROR[16] = {
+    UTF_ERROR_NONE,
+    UTF_ERROR_INVALID,
+    UTF_ERROR_INVALID,
+    UTF_ERROR_OUT_OF_BOUNDS,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+    UTF_ERROR_UNREACHABLE,
+};
+static const u8 UTF8_DFA_ACCEPT = 1;
+static const u8 UTF8_DFA_NEED   = 5;
+static const u8 UTF8_DFA_START  = 15;
+static const u8 UTF8_DFA_END    = 13;
+
 UTF_Result str8_decode(String_8 self, isize index)
 {
     UTF_Result result = {};
 
-    u32   value  = 0;
-    isize units  = 0;
     u8*   memory = self.memory + index;
+    isize length = self.length - index;
+    u8    stub   = 0;
 
-    if (index < 0 || index > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
-    else
-        units = utf8_get_units_ahead(memory[0]);
-
-    if (index + units > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
-
-    for (isize i = 1; i < units; i += 1) {
-        bool state = utf8_is_trailing(memory[i]);
-
-        if (state == false)
-            result.error = UTF_ERROR_INVALID;
-    }
-
-    if (result.error != UTF_ERROR_NONE) return result;
-
-    switch (units) {
-        case 1: { value = memory[0]; } break;
+    if (index < 0) length = 0;
 
-        case 2: {
-            value  = (memory[0] & 0x1f) << 6;
-            value += (memory[1] & 0x3f);
-        } break;
+    u8* source = length > 0 ? memory : &stub;
+    u8  byte   = *source;
+    u8  kind   = length > 0 ? UTF8_DFA_CLASS[byte] : UTF8_DFA_END;
+    u8  state  = UTF8_DFA_STATE[UTF8_DFA_START][kind];
+    u32 value  = byte & UTF8_DFA_MASK[kind];
+    u8  units  = UTF8_DFA_UNITS[kind];
 
-        case 3: {
-            value  = (memory[0] & 0x0f) << 12;
-            value += (memory[1] & 0x3f) <<  6;
-            value += (memory[2] & 0x3f);
-        } break;
+    for (isize i = 1; i < 4; i += 1) {
+        source = i < length ? memory + i : &stub;
+        byte   = *source;
+        kind   = i < length ? UTF8_DFA_CLASS[byte] : UTF8_DFA_END;
 
-        case 4: {
-            value  = (memory[0] & 0x07) << 18;
-            value += (memory[1] & 0x3f) << 12;
-            value += (memory[2] & 0x3f) <<  6;
-            value += (memory[3] & 0x3f);
-        } break;
+        if (state >= UTF8_DFA_NEED)
+            value = (value << 6) | (byte & 0x3f);
 
-        default: { result.error = UTF_ERROR_UNREACHABLE; } break;
+        state = UTF8_DFA_STATE[state][kind];
     }
 
-    if (utf8_is_overlong(value, units) == true)
-        result.error = UTF_ERROR_OVERLONG;
-
-    if (unicode_is_surr_any(value) == true)
-        result.error = UTF_ERROR_SURROGATE;
-
-    if (unicode_is_invalid(value) == true)
-        result.error = UTF_ERROR_INVALID;
+    if (state > UTF8_DFA_ACCEPT) {
+        value = 0;
+        units = 0;
+    }
 
+    result.error = UTF8_DFA_ERROR[state];
     result.value = value;
     result.units = units;
 
     return result;
 }
 
-isize str8_count_as_utf16(String_8 self)
+#if PAX_SIMD != PAX_SIMD_NONE
+
+static const u8 UTF16_ASCII_MASK[32] = {
+    0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff,
+    0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff,
+    0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff,
+    0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff,
+};
+
+static const u8 UTF32_ASCII_MASK[32] = {
+    0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff,
+};
+
+static const u8 UTF8_TOO_SHORT  = 0x01;
+static const u8 UTF8_TOO_LONG   = 0x02;
+static const u8 UTF8_OVERLONG_3 = 0x04;
+static const u8 UTF8_TOO_LARGE  = 0x08;
+static const u8 UTF8_SURROGATE  = 0x10;
+static const u8 UTF8_OVERLONG_2 = 0x20;
+static const u8 UTF8_OVERLONG_4 = 0x40;
+static const u8 UTF8_TWO_CONTS  = 0x80;
+
+static const u8 UTF8_TOO_LARGE_1000 = 0x40;
+static const u8 UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+static const u8 UTF8_BYTE_1_HIGH[16] = {
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,
+
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,
+
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE  | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+};
+
+static const u8 UTF8_BYTE_1_LOW[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+};
+
+static const u8 UTF8_BYTE_2_HIGH[16] = {
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE  | UTF8_TOO_LARGE,
+
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,
+};
+
+static Simd_U8 utf8_simd_check(Simd_U8 block)
 {
-    isize index  = 0;
-    isize result = 0;
+    Simd_U8 prev_1 = simd_prev_1(block);
+    Simd_U8 prev_2 = simd_prev_2(block);
+    Simd_U8 prev_3 = simd_prev_3(block);
 
-    while (index < self.length) {
-        UTF_Result decode = str8_decode(self, index);
+    Simd_U8 byte_1_high = simd_lookup(simd_table(UTF8_BYTE_1_HIGH),
+        simd_shr(prev_1, 4));
 
-        if (decode.error != UTF_ERROR_NONE)
-            return -1;
+    Simd_U8 byte_1_low = simd_lookup(simd_table(UTF8_BYTE_1_LOW),
+        simd_and(prev_1, simd_splat(0x0f)));
 
-        result += utf16_get_units(decode.value);
+    Simd_U8 byte_2_high = simd_lookup(simd_table(UTF8_BYTE_2_HIGH),
+        simd_shr(block, 4));
 
-        index += decode.units;
-    }
+    Simd_U8 special = simd_and(simd_and(byte_1_high, byte_1_low),
+        byte_2_high);
 
-    return result;
+    Simd_U8 third  = simd_sub_sat(prev_2, simd_splat(0xe0 - 0x80));
+    Simd_U8 fourth = simd_sub_sat(prev_3, simd_splat(0xf0 - 0x80));
+
+    Simd_U8 must_cont = simd_and(simd_or(third, fourth),
+        simd_splat(0x80));
+
+    return simd_xor(must_cont, special);
 }
 
-isize str8_count_as_utf32(String_8 self)
+static u32 utf8_simd_leads(Simd_U8 block)
 {
-    isize index  = 0;
-    isize result = 0;
+    return ~(simd_mask(block) & ~simd_mask(simd_add(block, block)));
+}
 
-    while (index < self.length) {
-        UTF_Result decode = str8_decode(self, index);
+static isize utf8_simd_to_utf16(u8* memory, u16* string, isize* units)
+{
+    Simd_U8 block = simd_load(memory);
 
-        if (decode.error != UTF_ERROR_NONE)
-            return -1;
+    if (simd_mask(block) == 0) {
+        simd_store_wide(PAX_U8_PTR(string), block, simd_splat(0));
 
-        result += 1;
+        *units = SIMD_WIDTH;
 
-        index += decode.units;
+        return SIMD_WIDTH;
     }
 
-    return result;
-}
+    if (simd_any(utf8_simd_check(block)) == true) return 0;
 
-bool str8_to_utf16(String_8 self, String_16* string, Mem_Arena* arena)
-{
-    String_16 result = {};
+    if (simd_mask(simd_cmp_ge(block, simd_splat(0xf0))) != 0)
+        return 0;
 
-    isize marker = arena->offset;
-    isize units  = str8_count_as_utf16(self);
+    Simd_U8 next_1 = simd_next_1(block);
+    Simd_U8 next_2 = simd_next_2(block);
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16));
+    Simd_U8 is_3 = simd_cmp_ge(block, simd_splat(0xe0));
+    Simd_U8 is_2 = simd_xor(simd_cmp_ge(block, simd_splat(0xc0)), is_3);
 
-    if (block.memory == 0) return false;
+    Simd_U8 low_2 = simd_or(simd_shl(block, 6),
+        simd_and(next_1, simd_splat(0x3f)));
 
-    result.memory = (u16*)(block.memory);
-    result.length = units;
+    Simd_U8 low_3 = simd_or(simd_shl(next_1, 6),
+        simd_and(next_2, simd_splat(0x3f)));
 
-    isize index = 0;
-    isize other = 0;
+    Simd_U8 high_2 = simd_and(simd_shr(block, 2), simd_splat(0x07));
 
-    while (index < self.length) {
-        UTF_Result decode = str8_decode(self, index);
+    Simd_U8 high_3 = simd_or(simd_shl(block, 4),
+        simd_and(simd_shr(next_1, 2), simd_splat(0x0f)));
 
-        if (decode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+    Simd_U8 low  = simd_select(is_2, low_2, block);
+    Simd_U8 high = simd_select(is_2, high_2, simd_splat(0));
 
-            return false;
-        }
+    low  = simd_select(is_3, low_3, low);
+    high = simd_select(is_3, high_3, high);
 
-        UTF_Result encode = str16_encode(result, other,
-            decode.value);
+    u16 temp[SIMD_WIDTH];
 
-        if (encode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+    simd_store_wide(PAX_U8_PTR(temp), low, high);
 
-            return false;
-        }
+    isize bytes = SIMD_WIDTH - utf8_get_tail(memory, SIMD_WIDTH);
+    u64   range = ((u64)(1) << bytes) - 1;
+    u64   leads = utf8_simd_leads(block) & range;
+    isize count = 0;
 
-        index += decode.units;
-        other += encode.units;
+    while (leads != 0) {
+        string[count] = temp[bits_count_trailing(leads)];
+
+        leads &= leads - 1;
+        count += 1;
     }
 
-    *string = result;
+    *units = count;
 
-    return true;
+    return bytes;
 }
 
-bool str8_to_utf32(String_8 self, String_32* string, Mem_Arena* arena)
+#endif
+
+isize utf8_get_tail(u8* memory, isize length)
 {
-    String_32 result = {};
+    if (length >= 1 && memory[length - 1] >= 0xc0) return 1;
+    if (length >= 2 && memory[length - 2] >= 0xe0) return 2;
+    if (length >= 3 && memory[length - 3] >= 0xf0) return 3;
 
-    isize marker = arena->offset;
-    isize units  = str8_count_as_utf32(self);
+    return 0;
+}
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32));
+isize str8_count_ascii(String_8 self, isize index)
+{
+    isize other = index;
+    isize stop  = PAX_MIN(index + 8, self.length);
 
-    if (block.memory == 0) return false;
+    if (index < 0) return 0;
 
-    result.memory = (u32*)(block.memory);
-    result.length = units;
+    while (other < stop && self.memory[other] < 0x80)
+        other += 1;
 
-    isize index = 0;
-    isize other = 0;
+    if (other != index + 8) return other - index;
 
-    while (index < self.length) {
-        UTF_Result decode = str8_decode(self, index);
+#if PAX_SIMD != PAX_SIMD_NONE
 
-        if (decode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+    while (other + SIMD_WIDTH <= self.length) {
+        u32 mask = simd_mask(simd_load(self.memory + other));
 
-            return false;
-        }
+        if (mask != 0)
+            return other - index + bits_count_trailing(mask);
 
-        UTF_Result encode = str32_encode(result, other,
-            decode.value);
+        other += SIMD_WIDTH;
+    }
 
-        if (encode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+#endif
 
-            return false;
-        }
+    while (other + 8 <= self.length) {
+        u64 word = bits_load_u64(self.memory + other);
 
-        index += decode.units;
-        other += encode.units;
+        word &= 0x8080808080808080;
+
+        if (word != 0)
+            return other - index + bits_count_trailing(word) / 8;
+
+        other += 8;
     }
 
-    *string = result;
+    while (other < self.length && self.memory[other] < 0x80)
+        other += 1;
 
-    return true;
+    return other - index;
 }
 
-isize utf16_get_units(u32 value)
+UTF_Check str8_validate(String_8 self)
 {
-    isize units = 0;
+    UTF_Check result = {};
 
-    if (value >= 0x0     && value < 0x10000)  units = 1;
-    if (value >= 0x10000 && value < 0x110000) units = 2;
+    isize index = 0;
 
-    return units;
-}
+#if PAX_SIMD != PAX_SIMD_NONE
 
-isize utf16_get_units_ahead(u16 value)
-{
-    isize units = 0;
+    while (index + SIMD_WIDTH <= self.length) {
+        u8*     memory = self.memory + index;
+        Simd_U8 block  = simd_load(memory);
 
-    if      (value  < 0xd800 || value >= 0xe000) units = 1;
-    else if (value >= 0xd800 && value  < 0xdc00) units = 2;
+        if (simd_mask(block) == 0) {
+            index += SIMD_WIDTH;
 
-    return units;
-}
+            continue;
+        }
 
-bool str16_init(String_16* self, u16* value, isize limit)
-{
-    isize length = 0;
+        if (simd_any(utf8_simd_check(block)) == false) {
+            index += SIMD_WIDTH - utf8_get_tail(memory, SIMD_WIDTH);
 
-    if (value == 0) {
-        self->memory = 0;
-        self->length = 0;
+            continue;
+        }
 
-        return true;
-    }
+        isize stop = index + SIMD_WIDTH;
 
-    while (value[length] != 0) {
-        if (length >= limit)
-            return false;
+        while (index < stop) {
+            if (self.memory[index] < 0x80) {
+                index += str8_count_ascii(self, index);
 
-        length += 1;
-    }
+                continue;
+            }
 
-    self->memory = value;
-    self->length = length;
+            UTF_Result decode = str8_decode(self, index);
 
-    return true;
-}
+            if (decode.error != UTF_ERROR_NONE) {
+                result.error  = decode.error;
+                result.offset = index;
 
-UTF_Result str16_encode(String_16 self, isize index, u32 value)
-{
-    UTF_Result result = {};
+                return result;
+            }
 
-    isize units  = utf16_get_units(value);
-    isize stop   = index + units;
-    u16*  memory = self.memory + index;
+            index += decode.units;
+        }
+    }
 
-    if (unicode_is_invalid(value) == true)
-        result.error = UTF_ERROR_INVALID;
+#endif
 
-    if (unicode_is_surr_any(value) == true)
-        result.error = UTF_ERROR_SURROGATE;
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            index += str8_count_ascii(self, index);
 
-    if (index < 0 || stop > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+            continue;
+        }
 
-    if (result.error != UTF_ERROR_NONE) return result;
+        UTF_Result decode = str8_decode(self, index);
 
-    switch (units) {
-        case 1: {
-            memory[0] = (u16)(value);
-        } break;
-
-        case 2: {
-            u32 temp = value - 0x10000;
+        if (decode.error != UTF_ERROR_NONE) {
+            result.error  = decode.error;
+            result.offset = index;
 
-            memory[0] = (u16)((temp >>    10) + 0xd800);
-            memory[1] = (u16)((temp  & 0x3ff) + 0xdc00);
-        } break;
+            return result;
+        }
 
-        default: {
-            result.error = UTF_ERROR_UNREACHABLE;
-        } break;
+        index += decode.units;
     }
 
-    result.value = value;
-    result.units = units;
+    result.offset = index;
 
     return result;
 }
 
-UTF_Result str16_decode(String_16 self, isize index)
+isize str8_count_as_utf16(String_8 self)
 {
-    UTF_Result result = {};
+    isize index  = 0;
+    isize result = 0;
 
-    u32   value  = 0;
-    isize units  = 0;
-    u16*  memory = self.memory + index;
+#if PAX_SIMD != PAX_SIMD_NONE
 
-    if (index < 0 || index > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
-    else
-        units = utf16_get_units_ahead(memory[0]);
+    while (index + SIMD_WIDTH <= self.length) {
+        u8*     memory = self.memory + index;
+        Simd_U8 block  = simd_load(memory);
 
-    if (index + units > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+        if (simd_mask(block) == 0) {
+            index  += SIMD_WIDTH;
+            result += SIMD_WIDTH;
 
-    if (result.error != UTF_ERROR_NONE) return result;
+            continue;
+        }
 
-    switch (units) {
-        case 1: { value = memory[0]; } break;
+        if (simd_any(utf8_simd_check(block)) == false) {
+            isize bytes = SIMD_WIDTH - utf8_get_tail(memory, SIMD_WIDTH);
+            u64   range = ((u64)(1) << bytes) - 1;
 
-        case 2: {
-            bool state = unicode_is_surr_low(memory[1]);
+            u32 leads = utf8_simd_leads(block);
+            u32 pairs = simd_mask(simd_cmp_ge(block, simd_splat(0xf0)));
 
-            if (state == true) {
-                value  = 0x10000;
-                value += (memory[0] - 0xd800) << 10;
-                value += (memory[1] - 0xdc00);
-            } else
-                result.error = UTF_ERROR_INVALID;
-        } break;
+            result += bits_count_ones(leads & range);
+            result += bits_count_ones(pairs & range);
 
-        default: {
-            result.error = UTF_ERROR_UNREACHABLE;
-        } break;
-    }
+            index += bytes;
 
-    result.value = value;
-    result.units = units;
+            continue;
+        }
 
-    return result;
-}
+        isize stop = index + SIMD_WIDTH;
 
-isize str16_count_as_utf8(String_16 self)
-{
-    isize index  = 0;
-    isize result = 0;
+        while (index < stop) {
+            if (self.memory[index] < 0x80) {
+                isize ascii = str8_count_ascii(self, index);
+
+                index  += ascii;
+                result += ascii;
+
+                continue;
+            }
+
+            UTF_Result decode = str8_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE)
+                return -1;
+
+            result += utf16_get_units(decode.value);
+
+            index += decode.units;
+        }
+    }
+
+#endif
 
     while (index < self.length) {
-        UTF_Result decode = str16_decode(self, index);
+        if (self.memory[index] < 0x80) {
+            isize ascii = str8_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str8_decode(self, index);
 
         if (decode.error != UTF_ERROR_NONE)
             return -1;
 
-        result += utf8_get_units(decode.value);
+        result += utf16_get_units(decode.value);
 
         index += decode.units;
     }
@@ -481,13 +826,62 @@ isize str16_count_as_utf8(String_16 self)
     return result;
 }
 
-isize str16_count_as_utf32(String_16 self)
+isize str8_count_as_utf32(String_8 self)
 {
     isize index  = 0;
     isize result = 0;
 
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    while (index + SIMD_WIDTH <= self.length) {
+        u8*     memory = self.memory + index;
+        Simd_U8 block  = simd_load(memory);
+
+        if (simd_mask(block) == 0) {
+            index  += SIMD_WIDTH;
+            result += SIMD_WIDTH;
+
+            continue;
+        }
+
+        if (simd_any(utf8_simd_check(block)) == false) {
+            isize bytes = SIMD_WIDTH - utf8_get_tail(memory, SIMD_WIDTH);
+            u64   range = ((u64)(1) << bytes) - 1;
+
+            result += bits_count_ones(utf8_simd_leads(block) & range);
+
+            index += bytes;
+
+            continue;
+        }
+
+        isize stop = index + SIMD_WIDTH;
+
+        while (index < stop) {
+            UTF_Result decode = str8_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE)
+                return -1;
+
+            result += 1;
+
+            index += decode.units;
+        }
+    }
+
+#endif
+
     while (index < self.length) {
-        UTF_Result decode = str16_decode(self, index);
+        if (self.memory[index] < 0x80) {
+            isize ascii = str8_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str8_decode(self, index);
 
         if (decode.error != UTF_ERROR_NONE)
             return -1;
@@ -500,60 +894,124 @@ isize str16_count_as_utf32(String_16 self)
     return result;
 }
 
-bool str16_to_utf8(String_16 self, String_8* string, Mem_Arena* arena)
+bool str8_to_utf16(String_8 self, String_16* string, Mem_Arena* arena PAX_SITE_DEFINE)
 {
-    String_8 result = {};
+    String_16 result = {};
 
     isize marker = arena->offset;
-    isize units  = str16_count_as_utf8(self);
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX - 1)
+        units = self.length;
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8));
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str8_count_as_utf16(self);
+
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+    }
 
     if (block.memory == 0) return false;
 
-    result.memory = (u8*)(block.memory);
+    result.memory = (u16*)(block.memory);
     result.length = units;
 
     isize index = 0;
     isize other = 0;
 
     while (index < self.length) {
-        UTF_Result decode = str16_decode(self, index);
+        isize stop = self.length;
 
-        if (decode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+#if PAX_SIMD != PAX_SIMD_NONE
 
-            return false;
-        }
+        isize input  = self.length - index;
+        isize output = result.length - other;
 
-        UTF_Result encode = str8_encode(result, other,
-            decode.value);
+        if (input >= SIMD_WIDTH && output >= SIMD_WIDTH) {
+            isize count = 0;
+            isize bytes = utf8_simd_to_utf16(self.memory + index,
+                result.memory + other, &count);
 
-        if (encode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+            index += bytes;
+            other += count;
 
-            return false;
+            if (bytes != 0) continue;
+
+            stop = index + SIMD_WIDTH;
         }
 
-        index += decode.units;
-        other += encode.units;
+#endif
+
+        while (index < stop) {
+            if (self.memory[index] < 0x80) {
+                isize ascii = PAX_MIN(str8_count_ascii(self, index),
+                    result.length - other);
+
+                for (isize i = 0; i < ascii; i += 1)
+                    result.memory[other + i] = (u16)(self.memory[index + i]);
+
+                index += ascii;
+                other += ascii;
+
+                if (ascii != 0) continue;
+            }
+
+            UTF_Result decode = str8_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE) {
+                arena_pop(arena, marker);
+
+                return false;
+            }
+
+            UTF_Result encode = str16_encode(result, other,
+                decode.value);
+
+            if (encode.error != UTF_ERROR_NONE) {
+                arena_pop(arena, marker);
+
+                return false;
+            }
+
+            index += decode.units;
+            other += encode.units;
+        }
     }
 
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u16));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
     *string = result;
 
     return true;
 }
 
-bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena)
+bool str8_to_utf32(String_8 self, String_32* string, Mem_Arena* arena PAX_SITE_DEFINE)
 {
     String_32 result = {};
 
     isize marker = arena->offset;
-    isize units  = str16_count_as_utf32(self);
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX - 1)
+        units = self.length;
+
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str8_count_as_utf32(self);
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32));
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+    }
 
     if (block.memory == 0) return false;
 
@@ -564,7 +1022,20 @@ bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena)
     isize other = 0;
 
     while (index < self.length) {
-        UTF_Result decode = str16_decode(self, index);
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str8_count_ascii(self, index),
+                result.length - other);
+
+            for (isize i = 0; i < ascii; i += 1)
+                result.memory[other + i] = (u32)(self.memory[index + i]);
+
+            index += ascii;
+            other += ascii;
+
+            if (ascii != 0) continue;
+        }
+
+        UTF_Result decode = str8_decode(self, index);
 
         if (decode.error != UTF_ERROR_NONE) {
             arena_pop(arena, marker);
@@ -585,271 +1056,5280 @@ bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena)
         other += encode.units;
     }
 
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u32));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
     *string = result;
 
     return true;
 }
 
-bool str32_init(String_32* self, u32* value, isize limit)
+UTF_Batch str8_encode_many(String_8 self, isize index, String_32 values)
 {
-    isize length = 0;
-
-    if (value == 0) {
-        self->memory = 0;
-        self->length = 0;
+    UTF_Batch result = {};
 
-        return true;
-    }
+    isize start = index;
+    isize other = 0;
 
-    while (value[length] != 0) {
-        if (length >= limit)
-            return false;
+    if (index < 0 || index > self.length) {
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
 
-        length += 1;
+        return result;
     }
 
-    self->memory = value;
-    self->length = length;
+    while (other < values.length) {
+        if (values.memory[other] < 0x80) {
+            isize ascii = PAX_MIN(str32_count_ascii(values, other),
+                self.length - index);
 
-    return true;
-}
+            for (isize i = 0; i < ascii; i += 1)
+                self.memory[index + i] = (u8)(values.memory[other + i]);
 
-UTF_Result str32_encode(String_32 self, isize index, u32 value)
-{
-    UTF_Result result = {};
+            index += ascii;
+            other += ascii;
 
-    isize units  = 1;
-    isize stop   = index + units;
-    u32*  memory = self.memory + index;
+            if (ascii != 0) continue;
+        }
 
-    if (unicode_is_invalid(value) == true)
-        result.error = UTF_ERROR_INVALID;
+        u32        value  = values.memory[other];
+        UTF_Result encode = str8_encode(self, index, value);
 
-    if (unicode_is_surr_any(value) == true)
-        result.error = UTF_ERROR_SURROGATE;
+        if (encode.error == UTF_ERROR_OUT_OF_BOUNDS && unicode_is_valid(value) == true)
+            break;
 
-    if (index < 0 || stop > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+        if (encode.error != UTF_ERROR_NONE) {
+            result.error = encode.error;
 
-    if (result.error == UTF_ERROR_NONE) {
-        memory[0] = value;
+            break;
+        }
 
-        result.value = value;
-        result.units = units;
+        index += encode.units;
+        other += 1;
     }
 
+    result.consumed = other;
+    result.produced = index - start;
+
     return result;
 }
 
-UTF_Result str32_decode(String_32 self, isize index)
+UTF_Batch str8_decode_many(String_8 self, isize index, String_32 buffer)
 {
-    UTF_Result result = {};
-
-    u32   value  = 0;
-    isize units  = 0;
-    u32*  memory = self.memory + index;
+    UTF_Batch result = {};
 
-    if (index < 0 || index > self.length)
-        result.error = UTF_ERROR_OUT_OF_BOUNDS;
-    else
-        units = 1;
+    isize start = index;
+    isize other = 0;
 
-    if (index + units > self.length)
+    if (index < 0 || index > self.length) {
         result.error = UTF_ERROR_OUT_OF_BOUNDS;
 
-    if (result.error == UTF_ERROR_NONE) {
-        value = memory[0];
-
-        result.value = value;
-        result.units = units;
+        return result;
     }
 
-    return result;
-}
-
-isize str32_count_as_utf8(String_32 self)
-{
-    isize result = 0;
-
-    for (isize i = 0; i < self.length; i += 1) {
-        UTF_Result decode = str32_decode(self, i);
+    while (index < self.length && other < buffer.length) {
+        isize stop = self.length;
 
-        if (decode.error != UTF_ERROR_NONE)
-            return -1;
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str8_count_ascii(self, index),
+                buffer.length - other);
 
-        result += utf8_get_units(decode.value);
-    }
+            for (isize i = 0; i < ascii; i += 1)
+                buffer.memory[other + i] = (u32)(self.memory[index + i]);
 
-    return result;
-}
+            index += ascii;
+            other += ascii;
 
-isize str32_count_as_utf16(String_32 self)
-{
-    isize result = 0;
+            continue;
+        }
 
-    for (isize i = 0; i < self.length; i += 1) {
-        UTF_Result decode = str32_decode(self, i);
+#if PAX_SIMD != PAX_SIMD_NONE
 
-        if (decode.error != UTF_ERROR_NONE)
-            return -1;
+        isize input  = self.length - index;
+        isize output = buffer.length - other;
 
-        result += utf16_get_units(decode.value);
-    }
+        if (input >= SIMD_WIDTH && output >= SIMD_WIDTH) {
+            u16   temp[SIMD_WIDTH];
+            isize count = 0;
+            isize bytes = utf8_simd_to_utf16(self.memory + index,
+                temp, &count);
 
-    return result;
-}
+            for (isize i = 0; i < count; i += 1)
+                buffer.memory[other + i] = (u32)(temp[i]);
 
-bool str32_to_utf8(String_32 self, String_8* string, Mem_Arena* arena)
-{
-    String_8 result = {};
+            index += bytes;
+            other += count;
 
-    isize marker = arena->offset;
-    isize units  = str32_count_as_utf8(self);
+            if (bytes != 0) continue;
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8));
+            stop = index + SIMD_WIDTH;
+        }
 
-    if (block.memory == 0) return false;
+#endif
 
-    result.memory = (u8*)(block.memory);
-    result.length = units;
+        while (index < stop && other < buffer.length) {
+            if (self.memory[index] < 0x80) {
+                buffer.memory[other] = (u32)(self.memory[index]);
 
-    isize index = 0;
-    isize other = 0;
+                index += 1;
+                other += 1;
 
-    while (index < self.length) {
-        UTF_Result decode = str32_decode(self, index);
+                continue;
+            }
 
-        if (decode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+            UTF_Result decode = str8_decode(self, index);
 
-            return false;
-        }
+            if (decode.error != UTF_ERROR_NONE) {
+                result.error = decode.error;
 
-        UTF_Result encode = str8_encode(result, other,
-            decode.value);
+                break;
+            }
 
-        if (encode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+            buffer.memory[other] = decode.value;
 
-            return false;
+            index += decode.units;
+            other += 1;
         }
 
-        index += decode.units;
-        other += encode.units;
+        if (result.error != UTF_ERROR_NONE) break;
     }
 
-    *string = result;
+    result.consumed = index - start;
+    result.produced = other;
 
-    return true;
+    return result;
 }
 
-bool str32_to_utf16(String_32 self, String_16* string, Mem_Arena* arena)
+static isize utf8_stream_fill(UTF8_Stream* self, String_8 chunk)
 {
-    String_16 result = {};
+    isize units = utf8_get_units_ahead(self->pending[0]);
+    isize index = 0;
+
+    while (self->count < units && index < chunk.length) {
+        u8 value = chunk.memory[index];
+
+        if (utf8_is_trailing(value) == false) break;
+
+        self->pending[self->count] = value;
+
+        self->count += 1;
+        index       += 1;
+    }
+
+    return index;
+}
+
+bool utf8_stream_to_utf16(UTF8_Stream* self, String_8 chunk, String_16* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_16 result = {};
+    String_16 middle = {};
+
+    UTF8_Stream state = *self;
+
+    isize marker = arena->offset;
+    isize index  = 0;
+
+    if (state.count != 0) {
+        index = utf8_stream_fill(&state, chunk);
+
+        isize units = utf8_get_units_ahead(state.pending[0]);
+
+        if (state.count < units && index == chunk.length) {
+            String_8 empty = {};
+
+            if (str8_to_utf16(empty, &result, arena PAX_SITE_FORWARD) == false)
+                return false;
+
+            *string = result;
+            *self   = state;
+
+            return true;
+        }
+
+        String_8   pending = {state.pending, state.count};
+        UTF_Result decode  = str8_decode(pending, 0);
+
+        if (decode.error != UTF_ERROR_NONE) return false;
+
+        Mem_Block block = arena_push_array_uninit(arena, utf16_get_units(decode.value),
+            PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+
+        if (block.memory == 0) return false;
+
+        result.memory = (u16*)(block.memory);
+        result.length = utf16_get_units(decode.value);
+
+        str16_encode(result, 0, decode.value);
+
+        state.count = 0;
+    }
+
+    chunk.memory += index;
+    chunk.length -= index;
+
+    isize tail = utf8_get_tail(chunk.memory, chunk.length);
+
+    chunk.length -= tail;
+
+    if (str8_to_utf16(chunk, &middle, arena PAX_SITE_FORWARD) == false) {
+        arena_pop(arena, marker);
+
+        return false;
+    }
+
+    if (result.memory != 0 && result.memory + result.length != middle.memory) {
+        Mem_Block block = arena_push_array_uninit(arena, result.length + middle.length + 1,
+            PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+
+        if (block.memory == 0) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        u16* memory = (u16*)(block.memory);
+
+        for (isize i = 0; i < result.length; i += 1)
+            memory[i] = result.memory[i];
+
+        for (isize i = 0; i <= middle.length; i += 1)
+            memory[result.length + i] = middle.memory[i];
+
+        result.memory = memory;
+        middle.memory = memory + result.length;
+    }
+
+    for (isize i = 0; i < tail; i += 1)
+        state.pending[i] = chunk.memory[chunk.length + i];
+
+    state.count = tail;
+
+    if (result.memory == 0)
+        result.memory = middle.memory;
+
+    result.length += middle.length;
+
+    *string = result;
+    *self   = state;
+
+    return true;
+}
+
+bool utf8_stream_to_utf32(UTF8_Stream* self, String_8 chunk, String_32* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_32 result = {};
+    String_32 middle = {};
+
+    UTF8_Stream state = *self;
+
+    isize marker = arena->offset;
+    isize index  = 0;
+
+    if (state.count != 0) {
+        index = utf8_stream_fill(&state, chunk);
+
+        isize units = utf8_get_units_ahead(state.pending[0]);
+
+        if (state.count < units && index == chunk.length) {
+            String_8 empty = {};
+
+            if (str8_to_utf32(empty, &result, arena PAX_SITE_FORWARD) == false)
+                return false;
+
+            *string = result;
+            *self   = state;
+
+            return true;
+        }
+
+        String_8   pending = {state.pending, state.count};
+        UTF_Result decode  = str8_decode(pending, 0);
+
+        if (decode.error != UTF_ERROR_NONE) return false;
+
+        Mem_Block block = arena_push_array_uninit(arena, 1,
+            PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+
+        if (block.memory == 0) return false;
+
+        result.memory = (u32*)(block.memory);
+        result.length = 1;
+
+        str32_encode(result, 0, decode.value);
+
+        state.count = 0;
+    }
+
+    chunk.memory += index;
+    chunk.length -= index;
+
+    isize tail = utf8_get_tail(chunk.memory, chunk.length);
+
+    chunk.length -= tail;
+
+    if (str8_to_utf32(chunk, &middle, arena PAX_SITE_FORWARD) == false) {
+        arena_pop(arena, marker);
+
+        return false;
+    }
+
+    if (result.memory != 0 && result.memory + result.length != middle.memory) {
+        Mem_Block block = arena_push_array_uninit(arena, result.length + middle.length + 1,
+            PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+
+        if (block.memory == 0) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        u32* memory = (u32*)(block.memory);
+
+        for (isize i = 0; i < result.length; i += 1)
+            memory[i] = result.memory[i];
+
+        for (isize i = 0; i <= middle.length; i += 1)
+            memory[result.length + i] = middle.memory[i];
+
+        result.memory = memory;
+        middle.memory = memory + result.length;
+    }
+
+    for (isize i = 0; i < tail; i += 1)
+        state.pending[i] = chunk.memory[chunk.length + i];
+
+    state.count = tail;
+
+    if (result.memory == 0)
+        result.memory = middle.memory;
+
+    result.length += middle.length;
+
+    *string = result;
+    *self   = state;
+
+    return true;
+}
+
+bool utf8_stream_finish(UTF8_Stream* self)
+{
+    return self->count == 0;
+}
+
+static isize utf8_count_leads(u8* memory, isize length)
+{
+    isize index  = 0;
+    isize result = 0;
+
+    while (index + 8 <= length) {
+        u64 word = bits_load_u64(memory + index);
+
+        word = word & ~(word << 1) & 0x8080808080808080;
+
+        result += 8 - bits_count_ones(word);
+        index  += 8;
+    }
+
+    while (index < length) {
+        if (utf8_is_trailing(memory[index]) == false)
+            result += 1;
+
+        index += 1;
+    }
+
+    return result;
+}
+
+static bool utf8_index_push(UTF8_Index* self, isize offset, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    if (self->count == self->capacity) {
+        isize capacity = PAX_MAX(self->capacity * 2, 16);
+        isize stride   = PAX_SIZE_OF(isize);
+
+        if (capacity > PAX_ISIZE_MAX / stride) return false;
+
+        Mem_Block block = {PAX_U8_PTR(self->offsets), self->capacity * stride};
+
+        block = arena_resize(arena, block, capacity * stride, PAX_ALIGN_OF(isize) PAX_SITE_FORWARD);
+
+        if (block.memory == 0) return false;
+
+        self->offsets  = (isize*)(block.memory);
+        self->capacity = capacity;
+    }
+
+    self->offsets[self->count] = offset;
+
+    self->count += 1;
+
+    return true;
+}
+
+bool utf8_index_init(UTF8_Index* self, String_8 string, isize step, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    UTF8_Index result = {};
+
+    if (step <= 0) return false;
+
+    isize marker   = arena->offset;
+    isize capacity = string.length / step + 1;
+
+    Mem_Block block = arena_push_array_uninit(arena, capacity,
+        PAX_SIZE_OF(isize), PAX_ALIGN_OF(isize) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) return false;
+
+    result.offsets  = (isize*)(block.memory);
+    result.capacity = capacity;
+    result.step     = step;
+
+    if (utf8_index_append(&result, string, arena PAX_SITE_FORWARD) == false) {
+        arena_pop(arena, marker);
+
+        return false;
+    }
+
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + result.count * PAX_SIZE_OF(isize));
+
+    result.capacity = result.count;
+
+    *self = result;
+
+    return true;
+}
+
+bool utf8_index_append(UTF8_Index* self, String_8 string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    isize index = self->length;
+    isize point = self->points;
+    isize next  = self->count * self->step;
+
+    if (index < 0 || index > string.length) return false;
+
+    while (index < string.length) {
+        if (string.memory[index] < 0x80) {
+            isize ascii = str8_count_ascii(string, index);
+
+            while (next < point + ascii) {
+                if (utf8_index_push(self, index + next - point, arena PAX_SITE_FORWARD) == false)
+                    return false;
+
+                next += self->step;
+            }
+
+            index += ascii;
+            point += ascii;
+
+            self->length = index;
+            self->points = point;
+
+            continue;
+        }
+
+        UTF_Result decode = str8_decode(string, index);
+
+        if (decode.error == UTF_ERROR_OUT_OF_BOUNDS) break;
+
+        if (decode.error != UTF_ERROR_NONE) return false;
+
+        if (point == next) {
+            if (utf8_index_push(self, index, arena PAX_SITE_FORWARD) == false)
+                return false;
+
+            next += self->step;
+        }
+
+        index += decode.units;
+        point += 1;
+
+        self->length = index;
+        self->points = point;
+    }
+
+    return true;
+}
+
+isize utf8_index_to_offset(UTF8_Index* self, String_8 string, isize point)
+{
+    if (point < 0 || point > self->points) return -1;
+
+    if (point == self->points) return self->length;
+
+    isize offset = self->offsets[point / self->step];
+    isize count  = point % self->step;
+
+    for (isize i = 0; i < count; i += 1)
+        offset += utf8_get_units_ahead(string.memory[offset]);
+
+    return offset;
+}
+
+isize utf8_index_to_point(UTF8_Index* self, String_8 string, isize offset)
+{
+    if (offset < 0 || offset > self->length) return -1;
+
+    if (offset == self->length) return self->points;
+
+    isize lower = 0;
+    isize upper = self->count - 1;
+
+    while (lower < upper) {
+        isize middle = upper - (upper - lower) / 2;
+
+        if (self->offsets[middle] <= offset)
+            lower = middle;
+        else
+            upper = middle - 1;
+    }
+
+    isize start  = self->offsets[lower];
+    isize result = lower * self->step;
+
+    result += utf8_count_leads(string.memory + start, offset - start);
+
+    if (utf8_is_trailing(string.memory[offset]) == true)
+        result -= 1;
+
+    return result;
+}
+
+isize utf16_get_units(u32 value)
+{
+    isize units = 0;
+
+    if (value >= 0x0     && value < 0x10000)  units = 1;
+    if (value >= 0x10000 && value < 0x110000) units = 2;
+
+    return units;
+}
+
+isize utf16_get_units_ahead(u16 value)
+{
+    isize units = 0;
+
+    if      (value  < 0xd800 || value >= 0xe000) units = 1;
+    else if (value >= 0xd800 && value  < 0xdc00) units = 2;
+
+    return units;
+}
+
+bool str16_init(String_16* self, u16* value, isize limit)
+{
+    isize length = 0;
+
+    if (value == 0) {
+        self->memory = 0;
+        self->length = 0;
+
+        return true;
+    }
+
+    isize stop = PAX_MAX(limit, 0);
+
+#if PAX_ASAN
+
+    while (value[length] != 0) {
+        if (length >= stop)
+            return false;
+
+        length += 1;
+    }
+
+#elif PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 zero   = simd_splat(0);
+    isize   skip   = (isize)((u64)(value) & (SIMD_WIDTH - 1));
+    u8*     memory = PAX_U8_PTR(value) - skip;
+    isize   offset = -skip;
+
+    u64 mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+    mask = mask & (mask >> 1) & 0x5555555555555555;
+    mask = mask >> skip << skip;
+
+    while (mask == 0) {
+        memory += SIMD_WIDTH;
+        offset += SIMD_WIDTH;
+
+        if (offset / 2 > stop) return false;
+
+        mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+        mask = mask & (mask >> 1) & 0x5555555555555555;
+    }
+
+    length = (offset + bits_count_trailing(mask)) / 2;
+
+#else
+
+    isize skip   = (isize)((u64)(value) & 7);
+    u8*   memory = PAX_U8_PTR(value) - skip;
+    isize offset = -skip;
+    u64   word   = bits_load_u64(memory) | (((u64)(1) << (skip * 8)) - 1);
+
+    u64 mask = (word - 0x0001000100010001) & ~word & 0x8000800080008000;
+
+    while (mask == 0) {
+        memory += 8;
+        offset += 8;
+
+        if (offset / 2 > stop) return false;
+
+        word = bits_load_u64(memory);
+        mask = (word - 0x0001000100010001) & ~word & 0x8000800080008000;
+    }
+
+    length = (offset + bits_count_trailing(mask) / 8) / 2;
+
+#endif
+
+    if (length > stop) return false;
+
+    self->memory = value;
+    self->length = length;
+
+    return true;
+}
+
+isize str16_count_ascii(String_16 self, isize index)
+{
+    isize other = index;
+    isize stop  = PAX_MIN(index + 8, self.length);
+
+    if (index < 0) return 0;
+
+    while (other < stop && self.memory[other] < 0x80)
+        other += 1;
+
+    if (other != index + 8) return other - index;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 limit = simd_load((u8*)(UTF16_ASCII_MASK));
+    Simd_U8 zero  = simd_splat(0);
+
+    while (other + SIMD_WIDTH / 2 <= self.length) {
+        Simd_U8 block = simd_load(PAX_U8_PTR(self.memory + other));
+
+        u32 mask = ~simd_mask(simd_cmp_eq(simd_and(block, limit), zero));
+
+        if (mask != 0)
+            return other - index + bits_count_trailing(mask) / 2;
+
+        other += SIMD_WIDTH / 2;
+    }
+
+#endif
+
+    while (other + 4 <= self.length) {
+        u64 word = bits_load_u64(PAX_U8_PTR(self.memory + other));
+
+        word &= 0xff80ff80ff80ff80;
+
+        if (word != 0)
+            return other - index + bits_count_trailing(word) / 16;
+
+        other += 4;
+    }
+
+    while (other < self.length && self.memory[other] < 0x80)
+        other += 1;
+
+    return other - index;
+}
+
+UTF_Result str16_encode(String_16 self, isize index, u32 value)
+{
+    UTF_Result result = {};
+
+    isize units  = utf16_get_units(value);
+    isize stop   = index + units;
+    u16*  memory = self.memory + index;
+
+    if (unicode_is_invalid(value) == true)
+        result.error = UTF_ERROR_INVALID;
+
+    if (unicode_is_surr_any(value) == true)
+        result.error = UTF_ERROR_SURROGATE;
+
+    if (index < 0 || stop > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+    if (result.error != UTF_ERROR_NONE) return result;
+
+    switch (units) {
+        case 1: {
+            memory[0] = (u16)(value);
+        } break;
+
+        case 2: {
+            u32 temp = value - 0x10000;
+
+            memory[0] = (u16)((temp >>    10) + 0xd800);
+            memory[1] = (u16)((temp  & 0x3ff) + 0xdc00);
+        } break;
+
+        default: {
+            result.error = UTF_ERROR_UNREACHABLE;
+        } break;
+    }
+
+    result.value = value;
+    result.units = units;
+
+    return result;
+}
+
+UTF_Result str16_decode(String_16 self, isize index)
+{
+    UTF_Result result = {};
+
+    u32   value  = 0;
+    isize units  = 0;
+    u16*  memory = self.memory + index;
+
+    if (index < 0 || index > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+    else
+        units = utf16_get_units_ahead(memory[0]);
+
+    if (index + units > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+    if (result.error != UTF_ERROR_NONE) return result;
+
+    switch (units) {
+        case 1: { value = memory[0]; } break;
+
+        case 2: {
+            bool state = unicode_is_surr_low(memory[1]);
+
+            if (state == true) {
+                value  = 0x10000;
+                value += (memory[0] - 0xd800) << 10;
+                value += (memory[1] - 0xdc00);
+            } else
+                result.error = UTF_ERROR_INVALID;
+        } break;
+
+        default: {
+            result.error = UTF_ERROR_UNREACHABLE;
+        } break;
+    }
+
+    result.value = value;
+    result.units = units;
+
+    return result;
+}
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+static isize utf16_simd_lanes(Simd_U8 high)
+{
+    u64 range = ((u64)(1) << SIMD_WIDTH) - 1;
+
+    u64 surr_high = simd_mask(simd_xor(simd_cmp_ge(high, simd_splat(0xd8)),
+        simd_cmp_ge(high, simd_splat(0xdc))));
+
+    u64 surr_low = simd_mask(simd_xor(simd_cmp_ge(high, simd_splat(0xdc)),
+        simd_cmp_ge(high, simd_splat(0xe0))));
+
+    if (((surr_high << 1) & range) != surr_low) return 0;
+
+    return SIMD_WIDTH - (isize)(surr_high >> (SIMD_WIDTH - 1));
+}
+
+static isize utf16_simd_to_utf8(u16* memory, u8* string, isize* units)
+{
+    Simd_U8 low  = {};
+    Simd_U8 high = {};
+
+    simd_load_wide(PAX_U8_PTR(memory), &low, &high);
+
+    Simd_U8 zero = simd_splat(0);
+    Simd_U8 cont = simd_splat(0x80);
+
+    Simd_U8 is_1 = simd_cmp_eq(simd_or(high, simd_and(low, cont)), zero);
+
+    if (simd_mask(is_1) == ((u64)(1) << SIMD_WIDTH) - 1) {
+        simd_store(string, low);
+
+        *units = SIMD_WIDTH;
+
+        return SIMD_WIDTH;
+    }
+
+    isize lanes = utf16_simd_lanes(high);
+
+    if (lanes == 0) return 0;
+
+    Simd_U8 is_3 = simd_cmp_ge(high, simd_splat(0x08));
+    Simd_U8 is_2 = simd_xor(simd_or(is_1, is_3), simd_splat(0xff));
+    Simd_U8 is_4 = simd_xor(simd_cmp_ge(high, simd_splat(0xd8)),
+        simd_cmp_ge(high, simd_splat(0xdc)));
+
+    Simd_U8 is_0 = simd_xor(simd_cmp_ge(high, simd_splat(0xdc)),
+        simd_cmp_ge(high, simd_splat(0xe0)));
+
+    Simd_U8 low_6 = simd_or(simd_and(low, simd_splat(0x3f)), cont);
+
+    Simd_U8 byte_0 = low;
+    Simd_U8 byte_1 = zero;
+    Simd_U8 byte_2 = zero;
+    Simd_U8 byte_3 = zero;
+
+    byte_0 = simd_select(is_2, simd_or(simd_splat(0xc0),
+        simd_or(simd_shl(high, 2), simd_shr(low, 6))), byte_0);
+
+    byte_1 = simd_select(is_2, low_6, byte_1);
+
+    byte_0 = simd_select(is_3, simd_or(simd_splat(0xe0),
+        simd_shr(high, 4)), byte_0);
+
+    byte_1 = simd_select(is_3, simd_or(cont, simd_or(simd_shl(simd_and(high,
+        simd_splat(0x0f)), 2), simd_shr(low, 6))), byte_1);
+
+    byte_2 = simd_select(is_3, low_6, byte_2);
+
+    Simd_U8 next_low  = simd_next_1(low);
+    Simd_U8 next_high = simd_next_1(high);
+
+    Simd_U8 plane = simd_add(simd_or(simd_shl(simd_and(high, simd_splat(0x03)), 2),
+        simd_shr(low, 6)), simd_splat(0x01));
+
+    byte_0 = simd_select(is_4, simd_or(simd_splat(0xf0),
+        simd_shr(plane, 2)), byte_0);
+
+    byte_1 = simd_select(is_4, simd_or(cont, simd_or(simd_shl(simd_and(plane,
+        simd_splat(0x03)), 4), simd_and(simd_shr(low, 2), simd_splat(0x0f)))), byte_1);
+
+    byte_2 = simd_select(is_4, simd_or(cont, simd_or(simd_shl(simd_and(low,
+        simd_splat(0x03)), 4), simd_or(simd_shl(simd_and(next_high,
+        simd_splat(0x03)), 2), simd_shr(next_low, 6)))), byte_2);
+
+    byte_3 = simd_select(is_4, simd_or(cont, simd_and(next_low,
+        simd_splat(0x3f))), byte_3);
+
+    Simd_U8 length = simd_and(is_1, simd_splat(1));
+
+    length = simd_select(is_2, simd_splat(2), length);
+    length = simd_select(is_3, simd_splat(3), length);
+    length = simd_select(is_4, simd_splat(4), length);
+    length = simd_select(is_0, zero, length);
+
+    u8 temp[5][SIMD_WIDTH];
+
+    simd_store(temp[0], byte_0);
+    simd_store(temp[1], byte_1);
+    simd_store(temp[2], byte_2);
+    simd_store(temp[3], byte_3);
+    simd_store(temp[4], length);
+
+    isize count = 0;
+
+    for (isize i = 0; i < lanes; i += 1) {
+        string[count + 0] = temp[0][i];
+        string[count + 1] = temp[1][i];
+        string[count + 2] = temp[2][i];
+        string[count + 3] = temp[3][i];
+
+        count += temp[4][i];
+    }
+
+    *units = count;
+
+    return lanes;
+}
+
+#endif
+
+isize str16_count_as_utf8(String_16 self)
+{
+    isize index  = 0;
+    isize result = 0;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    while (index + SIMD_WIDTH <= self.length) {
+        Simd_U8 low  = {};
+        Simd_U8 high = {};
+
+        simd_load_wide(PAX_U8_PTR(self.memory + index), &low, &high);
+
+        isize lanes = utf16_simd_lanes(high);
+
+        if (lanes != 0) {
+            u64 range = ((u64)(1) << lanes) - 1;
+
+            u64 wide = ~simd_mask(simd_cmp_eq(simd_or(high,
+                simd_and(low, simd_splat(0x80))), simd_splat(0)));
+
+            u64 three = simd_mask(simd_cmp_ge(high, simd_splat(0x08)));
+
+            u64 surr_high = simd_mask(simd_xor(simd_cmp_ge(high, simd_splat(0xd8)),
+                simd_cmp_ge(high, simd_splat(0xdc))));
+
+            u64 surr_low = simd_mask(simd_xor(simd_cmp_ge(high, simd_splat(0xdc)),
+                simd_cmp_ge(high, simd_splat(0xe0))));
+
+            result += lanes;
+            result += bits_count_ones(wide & range);
+            result += bits_count_ones(three & range);
+            result += bits_count_ones(surr_high & range);
+            result -= bits_count_ones(surr_low & range) * 3;
+
+            index += lanes;
+
+            continue;
+        }
+
+        isize stop = index + SIMD_WIDTH;
+
+        while (index < stop) {
+            if (self.memory[index] < 0x80) {
+                isize ascii = str16_count_ascii(self, index);
+
+                index  += ascii;
+                result += ascii;
+
+                continue;
+            }
+
+            UTF_Result decode = str16_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE)
+                return -1;
+
+            result += utf8_get_units(decode.value);
+
+            index += decode.units;
+        }
+    }
+
+#endif
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = str16_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str16_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE)
+            return -1;
+
+        result += utf8_get_units(decode.value);
+
+        index += decode.units;
+    }
+
+    return result;
+}
+
+isize str16_count_as_utf32(String_16 self)
+{
+    isize index  = 0;
+    isize result = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = str16_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str16_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE)
+            return -1;
+
+        result += 1;
+
+        index += decode.units;
+    }
+
+    return result;
+}
+
+bool str16_to_utf8(String_16 self, String_8* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_8 result = {};
+
+    isize marker = arena->offset;
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX / 4)
+        units = self.length * 3;
+
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str16_count_as_utf8(self);
+
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8) PAX_SITE_FORWARD);
+    }
+
+    if (block.memory == 0) return false;
+
+    result.memory = (u8*)(block.memory);
+    result.length = units;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        isize stop = self.length;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+        isize input  = self.length - index;
+        isize output = result.length - other;
+
+        if (input >= SIMD_WIDTH && output >= SIMD_WIDTH * 4) {
+            isize count = 0;
+            isize lanes = utf16_simd_to_utf8(self.memory + index,
+                result.memory + other, &count);
+
+            index += lanes;
+            other += count;
+
+            if (lanes != 0) continue;
+
+            stop = index + SIMD_WIDTH;
+        }
+
+#endif
+
+        while (index < stop) {
+            if (self.memory[index] < 0x80) {
+                isize ascii = PAX_MIN(str16_count_ascii(self, index),
+                    result.length - other);
+
+                for (isize i = 0; i < ascii; i += 1)
+                    result.memory[other + i] = (u8)(self.memory[index + i]);
+
+                index += ascii;
+                other += ascii;
+
+                if (ascii != 0) continue;
+            }
+
+            UTF_Result decode = str16_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE) {
+                arena_pop(arena, marker);
+
+                return false;
+            }
+
+            UTF_Result encode = str8_encode(result, other,
+                decode.value);
+
+            if (encode.error != UTF_ERROR_NONE) {
+                arena_pop(arena, marker);
+
+                return false;
+            }
+
+            index += decode.units;
+            other += encode.units;
+        }
+    }
+
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u8));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_32 result = {};
+
+    isize marker = arena->offset;
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX - 1)
+        units = self.length;
+
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str16_count_as_utf32(self);
+
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u32), PAX_ALIGN_OF(u32) PAX_SITE_FORWARD);
+    }
+
+    if (block.memory == 0) return false;
+
+    result.memory = (u32*)(block.memory);
+    result.length = units;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str16_count_ascii(self, index),
+                result.length - other);
+
+            for (isize i = 0; i < ascii; i += 1)
+                result.memory[other + i] = (u32)(self.memory[index + i]);
+
+            index += ascii;
+            other += ascii;
+
+            if (ascii != 0) continue;
+        }
+
+        UTF_Result decode = str16_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        UTF_Result encode = str32_encode(result, other,
+            decode.value);
+
+        if (encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u32));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+UTF_Batch str16_encode_many(String_16 self, isize index, String_32 values)
+{
+    UTF_Batch result = {};
+
+    isize start = index;
+    isize other = 0;
+
+    if (index < 0 || index > self.length) {
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+        return result;
+    }
+
+    while (other < values.length) {
+        if (values.memory[other] < 0x80) {
+            isize ascii = PAX_MIN(str32_count_ascii(values, other),
+                self.length - index);
+
+            for (isize i = 0; i < ascii; i += 1)
+                self.memory[index + i] = (u16)(values.memory[other + i]);
+
+            index += ascii;
+            other += ascii;
+
+            if (ascii != 0) continue;
+        }
+
+        u32        value  = values.memory[other];
+        UTF_Result encode = str16_encode(self, index, value);
+
+        if (encode.error == UTF_ERROR_OUT_OF_BOUNDS && unicode_is_valid(value) == true)
+            break;
+
+        if (encode.error != UTF_ERROR_NONE) {
+            result.error = encode.error;
+
+            break;
+        }
+
+        index += encode.units;
+        other += 1;
+    }
+
+    result.consumed = other;
+    result.produced = index - start;
+
+    return result;
+}
+
+UTF_Batch str16_decode_many(String_16 self, isize index, String_32 buffer)
+{
+    UTF_Batch result = {};
+
+    isize start = index;
+    isize other = 0;
+
+    if (index < 0 || index > self.length) {
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+        return result;
+    }
+
+    while (index < self.length && other < buffer.length) {
+        isize stop = self.length;
+
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str16_count_ascii(self, index),
+                buffer.length - other);
+
+            for (isize i = 0; i < ascii; i += 1)
+                buffer.memory[other + i] = (u32)(self.memory[index + i]);
+
+            index += ascii;
+            other += ascii;
+
+            continue;
+        }
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+        isize input  = self.length - index;
+        isize output = buffer.length - other;
+
+        if (input >= SIMD_WIDTH && output >= SIMD_WIDTH) {
+            Simd_U8 low  = {};
+            Simd_U8 high = {};
+
+            simd_load_wide(PAX_U8_PTR(self.memory + index), &low, &high);
+
+            Simd_U8 surr = simd_xor(simd_cmp_ge(high, simd_splat(0xd8)),
+                simd_cmp_ge(high, simd_splat(0xe0)));
+
+            if (simd_mask(surr) == 0) {
+                for (isize i = 0; i < SIMD_WIDTH; i += 1)
+                    buffer.memory[other + i] = (u32)(self.memory[index + i]);
+
+                index += SIMD_WIDTH;
+                other += SIMD_WIDTH;
+
+                continue;
+            }
+
+            stop = index + SIMD_WIDTH;
+        }
+
+#endif
+
+        while (index < stop && other < buffer.length) {
+            UTF_Result decode = str16_decode(self, index);
+
+            if (decode.error != UTF_ERROR_NONE) {
+                result.error = decode.error;
+
+                break;
+            }
+
+            buffer.memory[other] = decode.value;
+
+            index += decode.units;
+            other += 1;
+        }
+
+        if (result.error != UTF_ERROR_NONE) break;
+    }
+
+    result.consumed = index - start;
+    result.produced = other;
+
+    return result;
+}
+
+bool str32_init(String_32* self, u32* value, isize limit)
+{
+    isize length = 0;
+
+    if (value == 0) {
+        self->memory = 0;
+        self->length = 0;
+
+        return true;
+    }
+
+    isize stop = PAX_MAX(limit, 0);
+
+#if PAX_ASAN
+
+    while (value[length] != 0) {
+        if (length >= stop)
+            return false;
+
+        length += 1;
+    }
+
+#elif PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 zero   = simd_splat(0);
+    isize   skip   = (isize)((u64)(value) & (SIMD_WIDTH - 1));
+    u8*     memory = PAX_U8_PTR(value) - skip;
+    isize   offset = -skip;
+
+    u64 mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+    mask = mask & (mask >> 1) & (mask >> 2) & (mask >> 3) & 0x1111111111111111;
+    mask = mask >> skip << skip;
+
+    while (mask == 0) {
+        memory += SIMD_WIDTH;
+        offset += SIMD_WIDTH;
+
+        if (offset / 4 > stop) return false;
+
+        mask = simd_mask(simd_cmp_eq(simd_load(memory), zero));
+        mask = mask & (mask >> 1) & (mask >> 2) & (mask >> 3) & 0x1111111111111111;
+    }
+
+    length = (offset + bits_count_trailing(mask)) / 4;
+
+#else
+
+    isize skip   = (isize)((u64)(value) & 7);
+    u8*   memory = PAX_U8_PTR(value) - skip;
+    isize offset = -skip;
+    u64   word   = bits_load_u64(memory) | (((u64)(1) << (skip * 8)) - 1);
+
+    u64 mask = (word - 0x0000000100000001) & ~word & 0x8000000080000000;
+
+    while (mask == 0) {
+        memory += 8;
+        offset += 8;
+
+        if (offset / 4 > stop) return false;
+
+        word = bits_load_u64(memory);
+        mask = (word - 0x0000000100000001) & ~word & 0x8000000080000000;
+    }
+
+    length = (offset + bits_count_trailing(mask) / 8) / 4;
+
+#endif
+
+    if (length > stop) return false;
+
+    self->memory = value;
+    self->length = length;
+
+    return true;
+}
+
+isize str32_count_ascii(String_32 self, isize index)
+{
+    isize other = index;
+    isize stop  = PAX_MIN(index + 8, self.length);
+
+    if (index < 0) return 0;
+
+    while (other < stop && self.memory[other] < 0x80)
+        other += 1;
+
+    if (other != index + 8) return other - index;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 limit = simd_load((u8*)(UTF32_ASCII_MASK));
+    Simd_U8 zero  = simd_splat(0);
+
+    while (other + SIMD_WIDTH / 4 <= self.length) {
+        Simd_U8 block = simd_load(PAX_U8_PTR(self.memory + other));
+
+        u32 mask = ~simd_mask(simd_cmp_eq(simd_and(block, limit), zero));
+
+        if (mask != 0)
+            return other - index + bits_count_trailing(mask) / 4;
+
+        other += SIMD_WIDTH / 4;
+    }
+
+#endif
+
+    while (other + 2 <= self.length) {
+        u64 word = bits_load_u64(PAX_U8_PTR(self.memory + other));
+
+        word &= 0xffffff80ffffff80;
+
+        if (word != 0)
+            return other - index + bits_count_trailing(word) / 32;
+
+        other += 2;
+    }
+
+    while (other < self.length && self.memory[other] < 0x80)
+        other += 1;
+
+    return other - index;
+}
+
+UTF_Result str32_encode(String_32 self, isize index, u32 value)
+{
+    UTF_Result result = {};
+
+    isize units  = 1;
+    isize stop   = index + units;
+    u32*  memory = self.memory + index;
+
+    if (unicode_is_invalid(value) == true)
+        result.error = UTF_ERROR_INVALID;
+
+    if (unicode_is_surr_any(value) == true)
+        result.error = UTF_ERROR_SURROGATE;
+
+    if (index < 0 || stop > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+    if (result.error == UTF_ERROR_NONE) {
+        memory[0] = value;
+
+        result.value = value;
+        result.units = units;
+    }
+
+    return result;
+}
+
+UTF_Result str32_decode(String_32 self, isize index)
+{
+    UTF_Result result = {};
+
+    u32   value  = 0;
+    isize units  = 0;
+    u32*  memory = self.memory + index;
+
+    if (index < 0 || index > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+    else
+        units = 1;
+
+    if (index + units > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+    if (result.error == UTF_ERROR_NONE) {
+        value = memory[0];
+
+        result.value = value;
+        result.units = units;
+    }
+
+    return result;
+}
+
+isize str32_count_as_utf8(String_32 self)
+{
+    isize index  = 0;
+    isize result = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = str32_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str32_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE)
+            return -1;
+
+        result += utf8_get_units(decode.value);
+
+        index += decode.units;
+    }
+
+    return result;
+}
+
+isize str32_count_as_utf16(String_32 self)
+{
+    isize index  = 0;
+    isize result = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = str32_count_ascii(self, index);
+
+            index  += ascii;
+            result += ascii;
+
+            continue;
+        }
+
+        UTF_Result decode = str32_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE)
+            return -1;
+
+        result += utf16_get_units(decode.value);
+
+        index += decode.units;
+    }
+
+    return result;
+}
+
+bool str32_to_utf8(String_32 self, String_8* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_8 result = {};
+
+    isize marker = arena->offset;
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX / 5)
+        units = self.length * 4;
+
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str32_count_as_utf8(self);
+
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u8), PAX_ALIGN_OF(u8) PAX_SITE_FORWARD);
+    }
+
+    if (block.memory == 0) return false;
+
+    result.memory = (u8*)(block.memory);
+    result.length = units;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str32_count_ascii(self, index),
+                result.length - other);
+
+            for (isize i = 0; i < ascii; i += 1)
+                result.memory[other + i] = (u8)(self.memory[index + i]);
+
+            index += ascii;
+            other += ascii;
+
+            if (ascii != 0) continue;
+        }
+
+        UTF_Result decode = str32_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        UTF_Result encode = str8_encode(result, other,
+            decode.value);
+
+        if (encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u8));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+bool str32_to_utf16(String_32 self, String_16* string, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    String_16 result = {};
+
+    isize marker = arena->offset;
+    isize units  = -1;
+
+    if (self.length < PAX_ISIZE_MAX / 3)
+        units = self.length * 2;
+
+    Mem_Block block = arena_push_array_uninit(arena, units + 1,
+        PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) {
+        units = str32_count_as_utf16(self);
+
+        block = arena_push_array_uninit(arena, units + 1,
+            PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16) PAX_SITE_FORWARD);
+    }
+
+    if (block.memory == 0) return false;
+
+    result.memory = (u16*)(block.memory);
+    result.length = units;
+
+    isize index = 0;
+    isize other = 0;
+
+    while (index < self.length) {
+        if (self.memory[index] < 0x80) {
+            isize ascii = PAX_MIN(str32_count_ascii(self, index),
+                result.length - other);
+
+            for (isize i = 0; i < ascii; i += 1)
+                result.memory[other + i] = (u16)(self.memory[index + i]);
+
+            index += ascii;
+            other += ascii;
+
+            if (ascii != 0) continue;
+        }
+
+        UTF_Result decode = str32_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        UTF_Result encode = str16_encode(result, other,
+            decode.value);
+
+        if (encode.error != UTF_ERROR_NONE) {
+            arena_pop(arena, marker);
+
+            return false;
+        }
+
+        index += decode.units;
+        other += encode.units;
+    }
+
+    isize offset = (isize)(block.memory - arena->memory);
+
+    arena_pop(arena, offset + (other + 1) * PAX_SIZE_OF(u16));
+
+    result.memory[other] = 0;
+    result.length        = other;
+
+    *string = result;
+
+    return true;
+}
+
+bool str8_is_equal(String_8 self, String_8 value)
+{
+    isize index = 0;
+
+    if (self.length != value.length) return false;
+
+    while (index + 8 <= self.length) {
+        u64 left  = bits_load_u64(self.memory + index);
+        u64 right = bits_load_u64(value.memory + index);
+
+        if (left != right) return false;
+
+        index += 8;
+    }
+
+    while (index < self.length) {
+        if (self.memory[index] != value.memory[index])
+            return false;
+
+        index += 1;
+    }
+
+    return true;
+}
+
+isize str8_find_byte(String_8 self, isize index, u8 value)
+{
+    if (index < 0 || index > self.length) return -1;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 splat = simd_splat(value);
+
+    while (index + SIMD_WIDTH <= self.length) {
+        Simd_U8 block = simd_load(self.memory + index);
+        u32     mask  = simd_mask(simd_cmp_eq(block, splat));
+
+        if (mask != 0)
+            return index + bits_count_trailing(mask);
+
+        index += SIMD_WIDTH;
+    }
+
+#endif
+
+    u64 splat_u64 = value * 0x0101010101010101;
+
+    while (index + 8 <= self.length) {
+        u64 word = bits_load_u64(self.memory + index);
+        u64 mask = bits_find_zero(word ^ splat_u64);
+
+        if (mask != 0)
+            return index + bits_count_trailing(mask) / 8;
+
+        index += 8;
+    }
+
+    while (index < self.length) {
+        if (self.memory[index] == value) return index;
+
+        index += 1;
+    }
+
+    return -1;
+}
+
+isize str8_find(String_8 self, isize index, String_8 value)
+{
+    if (index < 0 || index > self.length) return -1;
+
+    if (value.length <= 1) {
+        if (value.length == 0) return index;
+
+        return str8_find_byte(self, index, value.memory[0]);
+    }
+
+    isize stop  = self.length - value.length;
+    u8*   first = self.memory;
+    u8*   last  = self.memory + value.length - 1;
+
+    String_8 inner = {value.memory + 1, value.length - 2};
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 splat_first = simd_splat(value.memory[0]);
+    Simd_U8 splat_last  = simd_splat(value.memory[value.length - 1]);
+
+    while (index + SIMD_WIDTH - 1 <= stop) {
+        Simd_U8 block_first = simd_load(first + index);
+        Simd_U8 block_last  = simd_load(last + index);
+
+        u32 mask = simd_mask(simd_and(simd_cmp_eq(block_first, splat_first),
+            simd_cmp_eq(block_last, splat_last)));
+
+        while (mask != 0) {
+            isize    other  = index + bits_count_trailing(mask);
+            String_8 window = {first + other + 1, inner.length};
+
+            if (str8_is_equal(window, inner) == true) return other;
+
+            mask &= mask - 1;
+        }
+
+        index += SIMD_WIDTH;
+    }
+
+#endif
+
+    u64 splat_first_u64 = value.memory[0] * 0x0101010101010101;
+    u64 splat_last_u64  = value.memory[value.length - 1] * 0x0101010101010101;
+
+    while (index + 7 <= stop) {
+        u64 word_first = bits_load_u64(first + index);
+        u64 word_last  = bits_load_u64(last + index);
+
+        u64 mask = bits_find_zero(word_first ^ splat_first_u64) &
+            bits_find_zero(word_last ^ splat_last_u64);
+
+        while (mask != 0) {
+            isize    other  = index + bits_count_trailing(mask) / 8;
+            String_8 window = {first + other + 1, inner.length};
+
+            if (first[other] == value.memory[0] && last[other] == value.memory[value.length - 1] &&
+                str8_is_equal(window, inner) == true) return other;
+
+            mask &= mask - 1;
+        }
+
+        index += 8;
+    }
+
+    while (index <= stop) {
+        String_8 window = {first + index, value.length};
+
+        if (str8_is_equal(window, value) == true) return index;
+
+        index += 1;
+    }
+
+    return -1;
+}
+
+isize str8_find_any(String_8 self, isize index, String_8 values)
+{
+    bool table[256] = {};
+
+    if (index < 0 || index > self.length) return -1;
+
+    for (isize i = 0; i < values.length; i += 1)
+        table[values.memory[i]] = true;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    if (values.length <= 16) {
+        Simd_U8 splats[16];
+
+        for (isize i = 0; i < values.length; i += 1)
+            splats[i] = simd_splat(values.memory[i]);
+
+        while (index + SIMD_WIDTH <= self.length) {
+            Simd_U8 block = simd_load(self.memory + index);
+            Simd_U8 match = simd_splat(0);
+
+            for (isize i = 0; i < values.length; i += 1)
+                match = simd_or(match, simd_cmp_eq(block, splats[i]));
+
+            u32 mask = simd_mask(match);
+
+            if (mask != 0)
+                return index + bits_count_trailing(mask);
+
+            index += SIMD_WIDTH;
+        }
+    }
+
+#endif
+
+    while (index < self.length) {
+        if (table[self.memory[index]] == true) return index;
+
+        index += 1;
+    }
+
+    return -1;
+}
+
+void str8_split_init(Str8_Split* self, String_8 string)
+{
+    self->string = string;
+    self->offset = 0;
+}
+
+bool str8_split_next(Str8_Split* self, String_8 delimiter, String_8* value)
+{
+    String_8 result = {};
+
+    isize offset = self->offset;
+
+    if (offset > self->string.length) return false;
+
+    isize other = -1;
+
+    if (delimiter.length != 0)
+        other = str8_find(self->string, offset, delimiter);
+
+    if (other < 0) {
+        other = self->string.length;
+
+        self->offset = other + 1;
+    } else
+        self->offset = other + delimiter.length;
+
+    result.memory = self->string.memory + offset;
+    result.length = other - offset;
+
+    *value = result;
+
+    return true;
+}
+
+bool str8_split_next_line(Str8_Split* self, String_8* value)
+{
+    String_8 result = {};
+
+    isize offset = self->offset;
+
+    if (offset >= self->string.length) return false;
+
+    isize other = str8_find_byte(self->string, offset, '\n');
+
+    if (other < 0) {
+        other = self->string.length;
+
+        self->offset = other;
+    } else
+        self->offset = other + 1;
+
+    result.memory = self->string.memory + offset;
+    result.length = other - offset;
+
+    if (result.length > 0 && result.memory[result.length - 1] == '\r')
+        result.length -= 1;
+
+    *value = result;
+
+    return true;
+}
+
+static const u8 HASH_SECRET[192] = {
+    0x21, 0xa2, 0xbe, 0x4a, 0x9f, 0xf6, 0xb0, 0x2c, 0x89, 0x89, 0x14, 0x23, 0x47, 0x03, 0x17, 0x94,
+    0x03, 0xfe, 0x9d, 0x60, 0x50, 0x59, 0x55, 0xdd, 0x00, 0x28, 0xb1, 0xde, 0x50, 0xb1, 0xaf, 0xdb,
+    0xb6, 0x2c, 0x44, 0x6c, 0x2e, 0x9b, 0x78, 0x7e, 0xc4, 0xf8, 0xe4, 0xc7, 0x36, 0x56, 0x1e, 0xf4,
+    0xe4, 0xa7, 0xfb, 0xf8, 0x50, 0xd1, 0x59, 0x09, 0xea, 0x9e, 0xdb, 0x3c, 0xf1, 0x16, 0x73, 0xa9,
+    0x68, 0x00, 0x52, 0xf9, 0x58, 0x82, 0xcd, 0x74, 0x8b, 0x86, 0x16, 0xe1, 0x62, 0x4a, 0xc7, 0x55,
+    0xbd, 0x3c, 0x02, 0xa2, 0x99, 0xc7, 0xf4, 0xd2, 0xb9, 0x51, 0x7b, 0xa3, 0x79, 0xcb, 0x98, 0xdf,
+    0x05, 0x39, 0x4f, 0x52, 0x85, 0x58, 0x6f, 0x39, 0x76, 0xb2, 0xa3, 0x6c, 0x38, 0x56, 0x1d, 0xaf,
+    0x5a, 0xe8, 0x04, 0x51, 0x6b, 0xbe, 0xff, 0xa9, 0xb3, 0x33, 0xd5, 0x9f, 0x1b, 0xc5, 0xd0, 0x6b,
+    0x56, 0x4b, 0xab, 0x50, 0x1c, 0xe9, 0x0c, 0x98, 0xc5, 0x62, 0xfe, 0x80, 0x57, 0x39, 0xac, 0x28,
+    0xc7, 0xed, 0xbc, 0xa6, 0xe3, 0x12, 0x89, 0x76, 0x88, 0x7c, 0x2c, 0x33, 0xc9, 0xe8, 0xb3, 0x50,
+    0xda, 0x47, 0xbd, 0x20, 0xe5, 0xbf, 0x3b, 0xce, 0x4f, 0x7c, 0xbb, 0xe0, 0xe8, 0xc8, 0xa6, 0xcb,
+    0x6d, 0x34, 0x4a, 0x43, 0xb8, 0x4d, 0x19, 0xbf, 0x7f, 0x6d, 0x41, 0x60, 0x7b, 0x2a, 0x8f, 0x7d,
+};
+
+static const u64 HASH_PRIME_1 = 0x9e3779b185ebca87;
+static const u64 HASH_PRIME_2 = 0xc2b2ae3d27d4eb4f;
+static const u64 HASH_PRIME_3 = 0x165667b19e3779f9;
+static const u64 HASH_PRIME_4 = 0x85ebca77c2b2ae63;
+static const u64 HASH_PRIME_5 = 0x27d4eb2f165667c5;
+
+static const u32 HASH_PRIME_32_1 = 0x9e3779b1;
+static const u32 HASH_PRIME_32_2 = 0x85ebca77;
+static const u32 HASH_PRIME_32_3 = 0xc2b2ae3d;
+
+static const isize HASH_STRIPE  = 64;
+static const isize HASH_STRIPES = (PAX_SIZE_OF(HASH_SECRET) - HASH_STRIPE) / 8;
+static const isize HASH_BLOCK   = HASH_STRIPE * HASH_STRIPES;
+
+static u64 hash_fold(u64 value, u64 other)
+{
+    u64 high = 0;
+    u64 low  = bits_mul_u128(value, other, &high);
+
+    return low ^ high;
+}
+
+static u64 hash_finish(u64 value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111eb;
+    value ^= value >> 31;
+
+    return value;
+}
+
+static u64 hash_mix_16(u8* memory, u8* secret, u64 seed)
+{
+    u64 low  = bits_load_u64(memory)     ^ (bits_load_u64(secret)     + seed);
+    u64 high = bits_load_u64(memory + 8) ^ (bits_load_u64(secret + 8) - seed);
+
+    return hash_fold(low, high);
+}
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+static void hash_accumulate(Simd_U8* lanes, u8* memory, u8* secret)
+{
+    for (isize i = 0; i < HASH_STRIPE / SIMD_WIDTH; i += 1) {
+        Simd_U8 data = simd_load(memory + i * SIMD_WIDTH);
+        Simd_U8 key  = simd_xor(data, simd_load(secret + i * SIMD_WIDTH));
+
+        Simd_U8 product = simd_mul_u32(key, simd_shr_u64(key, 32));
+
+        lanes[i] = simd_add_u64(lanes[i],
+            simd_add_u64(simd_swap_u64(data), product));
+    }
+}
+
+static void hash_scramble(Simd_U8* lanes, u8* secret)
+{
+    Simd_U8 prime = simd_splat_u32(HASH_PRIME_32_1);
+
+    for (isize i = 0; i < HASH_STRIPE / SIMD_WIDTH; i += 1) {
+        Simd_U8 value = lanes[i];
+
+        value = simd_xor(value, simd_shr_u64(value, 47));
+        value = simd_xor(value, simd_load(secret + i * SIMD_WIDTH));
+
+        Simd_U8 low  = simd_mul_u32(value, prime);
+        Simd_U8 high = simd_mul_u32(simd_shr_u64(value, 32), prime);
+
+        lanes[i] = simd_add_u64(low, simd_shl_u64(high, 32));
+    }
+}
+
+#else
+
+static void hash_accumulate(u64* lanes, u8* memory, u8* secret)
+{
+    for (isize i = 0; i < HASH_STRIPE / 8; i += 1) {
+        u64 data = bits_load_u64(memory + i * 8);
+        u64 key  = data ^ bits_load_u64(secret + i * 8);
+
+        lanes[i ^ 1] += data;
+        lanes[i]     += (key & 0xffffffff) * (key >> 32);
+    }
+}
+
+static void hash_scramble(u64* lanes, u8* secret)
+{
+    for (isize i = 0; i < HASH_STRIPE / 8; i += 1) {
+        u64 value = lanes[i];
+
+        value ^= value >> 47;
+        value ^= bits_load_u64(secret + i * 8);
+
+        lanes[i] = value * HASH_PRIME_32_1;
+    }
+}
+
+#endif
+
+static u64 hash_long(u8* memory, isize length, u64 seed)
+{
+    u64 result = length * HASH_PRIME_1 + seed;
+    u8* secret = (u8*)(HASH_SECRET);
+
+    u64 acc[8] = {
+        HASH_PRIME_32_3, HASH_PRIME_1, HASH_PRIME_2, HASH_PRIME_3,
+        HASH_PRIME_4,    HASH_PRIME_32_2, HASH_PRIME_5, HASH_PRIME_32_1,
+    };
+
+    isize blocks  = (length - 1) / HASH_BLOCK;
+    isize stripes = (length - 1 - blocks * HASH_BLOCK) / HASH_STRIPE;
+    u8*   last    = secret + PAX_SIZE_OF(HASH_SECRET) - HASH_STRIPE;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 lanes[HASH_STRIPE / SIMD_WIDTH];
+
+    for (isize i = 0; i < HASH_STRIPE / SIMD_WIDTH; i += 1)
+        lanes[i] = simd_load(PAX_U8_PTR(acc) + i * SIMD_WIDTH);
+
+#else
+
+    u64* lanes = acc;
+
+#endif
+
+    for (isize i = 0; i < blocks; i += 1) {
+        u8* block = memory + i * HASH_BLOCK;
+
+        for (isize j = 0; j < HASH_STRIPES; j += 1)
+            hash_accumulate(lanes, block + j * HASH_STRIPE, secret + j * 8);
+
+        hash_scramble(lanes, last);
+    }
+
+    for (isize j = 0; j < stripes; j += 1) {
+        hash_accumulate(lanes, memory + blocks * HASH_BLOCK + j * HASH_STRIPE,
+            secret + j * 8);
+    }
+
+    hash_accumulate(lanes, memory + length - HASH_STRIPE, last - 7);
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    for (isize i = 0; i < HASH_STRIPE / SIMD_WIDTH; i += 1)
+        simd_store(PAX_U8_PTR(acc) + i * SIMD_WIDTH, lanes[i]);
+
+#endif
+
+    for (isize i = 0; i < 4; i += 1) {
+        u64 low  = acc[i * 2]     ^ bits_load_u64(secret + 11 + i * 16);
+        u64 high = acc[i * 2 + 1] ^ bits_load_u64(secret + 19 + i * 16);
+
+        result += hash_fold(low, high);
+    }
+
+    return hash_finish(result);
+}
+
+u64 hash_bytes(u8* memory, isize length, u64 seed)
+{
+    u64 result = 0;
+    u8* secret = (u8*)(HASH_SECRET);
+
+    if (length > 128) return hash_long(memory, length, seed);
+
+    if (length > 16) {
+        isize rounds = (length - 1) / 32 + 1;
+
+        result = length * HASH_PRIME_1;
+
+        for (isize i = 0; i < rounds; i += 1) {
+            result += hash_mix_16(memory + i * 16,
+                secret + i * 32, seed);
+
+            result += hash_mix_16(memory + length - (i + 1) * 16,
+                secret + i * 32 + 16, seed);
+        }
+
+        return hash_finish(result);
+    }
+
+    if (length > 8) {
+        u64 low  = bits_load_u64(memory)              ^ (bits_load_u64(secret + 24) + seed);
+        u64 high = bits_load_u64(memory + length - 8) ^ (bits_load_u64(secret + 32) - seed);
+
+        result = length + ((low << 32) | (low >> 32)) + high + hash_fold(low, high);
+
+        return hash_finish(result);
+    }
+
+    if (length >= 4) {
+        u64 low  = bits_load_u32(memory);
+        u64 high = bits_load_u32(memory + length - 4);
+
+        result = (low | (high << 32)) ^ (bits_load_u64(secret + 8) + seed);
+
+        return hash_finish(hash_fold(result, HASH_PRIME_1 + length));
+    }
+
+    if (length > 0) {
+        u64 value = ((u64)(memory[0])          << 16) |
+                    ((u64)(memory[length / 2]) << 24) |
+                    ((u64)(memory[length - 1]) <<  0) |
+                    ((u64)(length)             <<  8);
+
+        result = value ^ (bits_load_u64(secret) + seed);
+
+        return hash_finish(hash_fold(result, HASH_PRIME_1));
+    }
+
+    return hash_finish(seed ^ bits_load_u64(secret + 56) ^ bits_load_u64(secret + 64));
+}
+
+u64 hash_str8(String_8 value, u64 seed)
+{
+    return hash_bytes(value.memory, value.length, seed);
+}
+
+u64 hash_block(Mem_Block value, u64 seed)
+{
+    return hash_bytes(value.memory, value.length, seed);
+}
+
+static isize intern_probe(Intern_Table* self, String_8 value, u64 hash)
+{
+    isize mask  = self->capacity - 1;
+    isize index = (isize)(hash & mask);
+
+    while (self->slots[index].handle != 0) {
+        Intern_Slot slot = self->slots[index];
+
+        if (slot.hash == hash && str8_is_equal(self->strings[slot.handle - 1], value) == true)
+            return index;
+
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+static bool intern_grow(Intern_Table* self, isize capacity, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    isize unit = PAX_SIZE_OF(Intern_Slot) + PAX_SIZE_OF(String_8);
+
+    if (capacity > PAX_ISIZE_MAX / unit / 2) return false;
+
+    isize limit = capacity / 4 * 3;
+    isize size  = capacity * PAX_SIZE_OF(Intern_Slot);
+    isize bytes = size + limit * PAX_SIZE_OF(String_8);
+    isize extra = self->capacity * PAX_SIZE_OF(Intern_Slot);
+
+    Mem_Block block = arena_resize(arena, self->block, bytes + extra,
+        PAX_ALIGN_OF(Intern_Slot) PAX_SITE_FORWARD);
+
+    if (block.memory == 0) return false;
+
+    Intern_Slot* temp = (Intern_Slot*)(block.memory + bytes);
+
+    for (isize i = 0; i < self->capacity; i += 1)
+        temp[i] = self->slots[i];
+
+    Intern_Table result = {};
+
+    result.slots    = (Intern_Slot*)(block.memory);
+    result.strings  = (String_8*)(block.memory + size);
+    result.capacity = capacity;
+    result.limit    = limit;
+    result.count    = self->count;
+    result.spare    = self->spare;
+
+    for (isize i = self->count; i > 0; i -= 1)
+        result.strings[i - 1] = self->strings[i - 1];
+
+    for (isize i = 0; i < capacity; i += 1)
+        result.slots[i] = {};
+
+    for (isize i = 0; i < self->capacity; i += 1) {
+        Intern_Slot slot = temp[i];
+
+        if (slot.handle == 0) continue;
+
+        isize mask  = capacity - 1;
+        isize index = (isize)(slot.hash & mask);
+
+        while (result.slots[index].handle != 0)
+            index = (index + 1) & mask;
+
+        result.slots[index] = slot;
+    }
+
+    result.block = arena_resize(arena, block, bytes, PAX_ALIGN_OF(Intern_Slot) PAX_SITE_FORWARD);
+
+    if (block.memory != self->block.memory && self->block.length > result.spare.length)
+        result.spare = self->block;
+
+    *self = result;
+
+    return true;
+}
+
+static Mem_Block intern_push_key(Intern_Table* self, isize bytes, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+
+    if (bytes > self->spare.length)
+        return arena_push_uninit(arena, bytes, 1 PAX_SITE_FORWARD);
+
+    result.memory = self->spare.memory;
+    result.length = bytes;
+
+    self->spare.memory += bytes;
+    self->spare.length -= bytes;
+
+    return result;
+}
+
+bool intern_init(Intern_Table* self, isize capacity, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    Intern_Table result = {};
+
+    isize size = 16;
+
+    while (size / 4 * 3 < capacity) {
+        if (size > PAX_ISIZE_MAX / 2) return false;
+
+        size *= 2;
+    }
+
+    if (intern_grow(&result, size, arena PAX_SITE_FORWARD) == false)
+        return false;
+
+    *self = result;
+
+    return true;
+}
+
+isize intern_insert(Intern_Table* self, String_8 value, Mem_Arena* arena PAX_SITE_DEFINE)
+{
+    u64   hash  = hash_str8(value, 0);
+    isize index = intern_probe(self, value, hash);
+
+    if (self->slots[index].handle != 0)
+        return self->slots[index].handle;
+
+    if (self->count == self->limit) {
+        if (self->capacity > PAX_ISIZE_MAX / 2) return 0;
+
+        if (intern_grow(self, self->capacity * 2, arena PAX_SITE_FORWARD) == false)
+            return 0;
+
+        index = intern_probe(self, value, hash);
+    }
+
+    Mem_Block block = intern_push_key(self, value.length + 1, arena PAX_SITE_FORWARD);
+
+    if (block.memory == 0) return 0;
+
+    for (isize i = 0; i < value.length; i += 1)
+        block.memory[i] = value.memory[i];
+
+    block.memory[value.length] = 0;
+
+    String_8 string = {block.memory, value.length};
+
+    self->strings[self->count] = string;
+
+    self->count += 1;
+
+    self->slots[index].hash   = hash;
+    self->slots[index].handle = self->count;
+
+    return self->count;
+}
+
+isize intern_find(Intern_Table* self, String_8 value)
+{
+    u64   hash  = hash_str8(value, 0);
+    isize index = intern_probe(self, value, hash);
+
+    return self->slots[index].handle;
+}
+
+String_8 intern_get(Intern_Table* self, isize handle)
+{
+    String_8 result = {};
+
+    if (handle <= 0 || handle > self->count) return result;
+
+    return self->strings[handle - 1];
+}
+
+static const f64 PARSE_POW_10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const u64 PARSE_POW_10_U64[16] = {
+    1,
+    10,
+    100,
+    1000,
+    10000,
+    100000,
+    1000000,
+    10000000,
+    100000000,
+    1000000000,
+    10000000000,
+    100000000000,
+    1000000000000,
+    10000000000000,
+    100000000000000,
+    1000000000000000,
+};
+
+static const isize PARSE_POW_10_MIN = -348;
+static const isize PARSE_POW_10_MAX = 347;
+
+static const u64 PARSE_POW_10_WIDE[696][2] = {
+    {0x1732c869cd60e453, 0xfa8fd5a0081c0288},
+    {0x0e7fbd42205c8eb4, 0x9c99e58405118195},
+    {0x521fac92a873b261, 0xc3c05ee50655e1fa},
+    {0xe6a797b752909ef9, 0xf4b0769e47eb5a78},
+    {0x9028bed2939a635c, 0x98ee4a22ecf3188b},
+    {0x7432ee873880fc33, 0xbf29dcaba82fdeae},
+    {0x113faa2906a13b3f, 0xeef453d6923bd65a},
+    {0x4ac7ca59a424c507, 0x9558b4661b6565f8},
+    {0x5d79bcf00d2df649, 0xbaaee17fa23ebf76},
+    {0xf4d82c2c107973dc, 0xe95a99df8ace6f53},
+    {0x79071b9b8a4be869, 0x91d8a02bb6c10594},
+    {0x9748e2826cdee284, 0xb64ec836a47146f9},
+    {0xfd1b1b2308169b25, 0xe3e27a444d8d98b7},
+    {0xfe30f0f5e50e20f7, 0x8e6d8c6ab0787f72},
+    {0xbdbd2d335e51a935, 0xb208ef855c969f4f},
+    {0xad2c788035e61382, 0xde8b2b66b3bc4723},
+    {0x4c3bcb5021afcc31, 0x8b16fb203055ac76},
+    {0xdf4abe242a1bbf3d, 0xaddcb9e83c6b1793},
+    {0xd71d6dad34a2af0d, 0xd953e8624b85dd78},
+    {0x8672648c40e5ad68, 0x87d4713d6f33aa6b},
+    {0x680efdaf511f18c2, 0xa9c98d8ccb009506},
+    {0x0212bd1b2566def2, 0xd43bf0effdc0ba48},
+    {0x014bb630f7604b57, 0x84a57695fe98746d},
+    {0x419ea3bd35385e2d, 0xa5ced43b7e3e9188},
+    {0x52064cac828675b9, 0xcf42894a5dce35ea},
+    {0x7343efebd1940993, 0x818995ce7aa0e1b2},
+    {0x1014ebe6c5f90bf8, 0xa1ebfb4219491a1f},
+    {0xd41a26e077774ef6, 0xca66fa129f9b60a6},
+    {0x8920b098955522b4, 0xfd00b897478238d0},
+    {0x55b46e5f5d5535b0, 0x9e20735e8cb16382},
+    {0xeb2189f734aa831d, 0xc5a890362fddbc62},
+    {0xa5e9ec7501d523e4, 0xf712b443bbd52b7b},
+    {0x47b233c92125366e, 0x9a6bb0aa55653b2d},
+    {0x999ec0bb696e840a, 0xc1069cd4eabe89f8},
+    {0xc00670ea43ca250d, 0xf148440a256e2c76},
+    {0x380406926a5e5728, 0x96cd2a865764dbca},
+    {0xc605083704f5ecf2, 0xbc807527ed3e12bc},
+    {0xf7864a44c633682e, 0xeba09271e88d976b},
+    {0x7ab3ee6afbe0211d, 0x93445b8731587ea3},
+    {0x5960ea05bad82964, 0xb8157268fdae9e4c},
+    {0x6fb92487298e33bd, 0xe61acf033d1a45df},
+    {0xa5d3b6d479f8e056, 0x8fd0c16206306bab},
+    {0x8f48a4899877186c, 0xb3c4f1ba87bc8696},
+    {0x331acdabfe94de87, 0xe0b62e2929aba83c},
+    {0x9ff0c08b7f1d0b14, 0x8c71dcd9ba0b4925},
+    {0x07ecf0ae5ee44dd9, 0xaf8e5410288e1b6f},
+    {0xc9e82cd9f69d6150, 0xdb71e91432b1a24a},
+    {0xbe311c083a225cd2, 0x892731ac9faf056e},
+    {0x6dbd630a48aaf406, 0xab70fe17c79ac6ca},
+    {0x092cbbccdad5b108, 0xd64d3d9db981787d},
+    {0x25bbf56008c58ea5, 0x85f0468293f0eb4e},
+    {0xaf2af2b80af6f24e, 0xa76c582338ed2621},
+    {0x1af5af660db4aee1, 0xd1476e2c07286faa},
+    {0x50d98d9fc890ed4d, 0x82cca4db847945ca},
+    {0xe50ff107bab528a0, 0xa37fce126597973c},
+    {0x1e53ed49a96272c8, 0xcc5fc196fefd7d0c},
+    {0x25e8e89c13bb0f7a, 0xff77b1fcbebcdc4f},
+    {0x77b191618c54e9ac, 0x9faacf3df73609b1},
+    {0xd59df5b9ef6a2417, 0xc795830d75038c1d},
+    {0x4b0573286b44ad1d, 0xf97ae3d0d2446f25},
+    {0x4ee367f9430aec32, 0x9becce62836ac577},
+    {0x229c41f793cda73f, 0xc2e801fb244576d5},
+    {0x6b43527578c1110f, 0xf3a20279ed56d48a},
+    {0x830a13896b78aaa9, 0x9845418c345644d6},
+    {0x23cc986bc656d553, 0xbe5691ef416bd60c},
+    {0x2cbfbe86b7ec8aa8, 0xedec366b11c6cb8f},
+    {0x7bf7d71432f3d6a9, 0x94b3a202eb1c3f39},
+    {0xdaf5ccd93fb0cc53, 0xb9e08a83a5e34f07},
+    {0xd1b3400f8f9cff68, 0xe858ad248f5c22c9},
+    {0x23100809b9c21fa1, 0x91376c36d99995be},
+    {0xabd40a0c2832a78a, 0xb58547448ffffb2d},
+    {0x16c90c8f323f516c, 0xe2e69915b3fff9f9},
+    {0xae3da7d97f6792e3, 0x8dd01fad907ffc3b},
+    {0x99cd11cfdf41779c, 0xb1442798f49ffb4a},
+    {0x40405643d711d583, 0xdd95317f31c7fa1d},
+    {0x482835ea666b2572, 0x8a7d3eef7f1cfc52},
+    {0xda3243650005eecf, 0xad1c8eab5ee43b66},
+    {0x90bed43e40076a82, 0xd863b256369d4a40},
+    {0x5a7744a6e804a291, 0x873e4f75e2224e68},
+    {0x711515d0a205cb36, 0xa90de3535aaae202},
+    {0x0d5a5b44ca873e03, 0xd3515c2831559a83},
+    {0xe858790afe9486c2, 0x8412d9991ed58091},
+    {0x626e974dbe39a872, 0xa5178fff668ae0b6},
+    {0xfb0a3d212dc8128f, 0xce5d73ff402d98e3},
+    {0x7ce66634bc9d0b99, 0x80fa687f881c7f8e},
+    {0x1c1fffc1ebc44e80, 0xa139029f6a239f72},
+    {0xa327ffb266b56220, 0xc987434744ac874e},
+    {0x4bf1ff9f0062baa8, 0xfbe9141915d7a922},
+    {0x6f773fc3603db4a9, 0x9d71ac8fada6c9b5},
+    {0xcb550fb4384d21d3, 0xc4ce17b399107c22},
+    {0x7e2a53a146606a48, 0xf6019da07f549b2b},
+    {0x2eda7444cbfc426d, 0x99c102844f94e0fb},
+    {0xfa911155fefb5308, 0xc0314325637a1939},
+    {0x793555ab7eba27ca, 0xf03d93eebc589f88},
+    {0x4bc1558b2f3458de, 0x96267c7535b763b5},
+    {0x9eb1aaedfb016f16, 0xbbb01b9283253ca2},
+    {0x465e15a979c1cadc, 0xea9c227723ee8bcb},
+    {0x0bfacd89ec191ec9, 0x92a1958a7675175f},
+    {0xcef980ec671f667b, 0xb749faed14125d36},
+    {0x82b7e12780e7401a, 0xe51c79a85916f484},
+    {0xd1b2ecb8b0908810, 0x8f31cc0937ae58d2},
+    {0x861fa7e6dcb4aa15, 0xb2fe3f0b8599ef07},
+    {0x67a791e093e1d49a, 0xdfbdcece67006ac9},
+    {0xe0c8bb2c5c6d24e0, 0x8bd6a141006042bd},
+    {0x58fae9f773886e18, 0xaecc49914078536d},
+    {0xaf39a475506a899e, 0xda7f5bf590966848},
+    {0x6d8406c952429603, 0x888f99797a5e012d},
+    {0xc8e5087ba6d33b83, 0xaab37fd7d8f58178},
+    {0xfb1e4a9a90880a64, 0xd5605fcdcf32e1d6},
+    {0x5cf2eea09a55067f, 0x855c3be0a17fcd26},
+    {0xf42faa48c0ea481e, 0xa6b34ad8c9dfc06f},
+    {0xf13b94daf124da26, 0xd0601d8efc57b08b},
+    {0x76c53d08d6b70858, 0x823c12795db6ce57},
+    {0x54768c4b0c64ca6e, 0xa2cb1717b52481ed},
+    {0xa9942f5dcf7dfd09, 0xcb7ddcdda26da268},
+    {0xd3f93b35435d7c4c, 0xfe5d54150b090b02},
+    {0xc47bc5014a1a6daf, 0x9efa548d26e5a6e1},
+    {0x359ab6419ca1091b, 0xc6b8e9b0709f109a},
+    {0xc30163d203c94b62, 0xf867241c8cc6d4c0},
+    {0x79e0de63425dcf1d, 0x9b407691d7fc44f8},
+    {0x985915fc12f542e4, 0xc21094364dfb5636},
+    {0x3e6f5b7b17b2939d, 0xf294b943e17a2bc4},
+    {0xa705992ceecf9c42, 0x979cf3ca6cec5b5a},
+    {0x50c6ff782a838353, 0xbd8430bd08277231},
+    {0xa4f8bf5635246428, 0xece53cec4a314ebd},
+    {0x871b7795e136be99, 0x940f4613ae5ed136},
+    {0x28e2557b59846e3f, 0xb913179899f68584},
+    {0x331aeada2fe589cf, 0xe757dd7ec07426e5},
+    {0x3ff0d2c85def7621, 0x9096ea6f3848984f},
+    {0x0fed077a756b53a9, 0xb4bca50b065abe63},
+    {0xd3e8495912c62894, 0xe1ebce4dc7f16dfb},
+    {0x64712dd7abbbd95c, 0x8d3360f09cf6e4bd},
+    {0xbd8d794d96aacfb3, 0xb080392cc4349dec},
+    {0xecf0d7a0fc5583a0, 0xdca04777f541c567},
+    {0xf41686c49db57244, 0x89e42caaf9491b60},
+    {0x311c2875c522ced5, 0xac5d37d5b79b6239},
+    {0x7d633293366b828b, 0xd77485cb25823ac7},
+    {0xae5dff9c02033197, 0x86a8d39ef77164bc},
+    {0xd9f57f830283fdfc, 0xa8530886b54dbdeb},
+    {0xd072df63c324fd7b, 0xd267caa862a12d66},
+    {0x4247cb9e59f71e6d, 0x8380dea93da4bc60},
+    {0x52d9be85f074e608, 0xa46116538d0deb78},
+    {0x67902e276c921f8b, 0xcd795be870516656},
+    {0x00ba1cd8a3db53b6, 0x806bd9714632dff6},
+    {0x80e8a40eccd228a4, 0xa086cfcd97bf97f3},
+    {0x6122cd128006b2cd, 0xc8a883c0fdaf7df0},
+    {0x796b805720085f81, 0xfad2a4b13d1b5d6c},
+    {0xcbe3303674053bb0, 0x9cc3a6eec6311a63},
+    {0xbedbfc4411068a9c, 0xc3f490aa77bd60fc},
+    {0xee92fb5515482d44, 0xf4f1b4d515acb93b},
+    {0x751bdd152d4d1c4a, 0x991711052d8bf3c5},
+    {0xd262d45a78a0635d, 0xbf5cd54678eef0b6},
+    {0x86fb897116c87c34, 0xef340a98172aace4},
+    {0xd45d35e6ae3d4da0, 0x9580869f0e7aac0e},
+    {0x8974836059cca109, 0xbae0a846d2195712},
+    {0x2bd1a438703fc94b, 0xe998d258869facd7},
+    {0x7b6306a34627ddcf, 0x91ff83775423cc06},
+    {0x1a3bc84c17b1d542, 0xb67f6455292cbf08},
+    {0x20caba5f1d9e4a93, 0xe41f3d6a7377eeca},
+    {0x547eb47b7282ee9c, 0x8e938662882af53e},
+    {0xe99e619a4f23aa43, 0xb23867fb2a35b28d},
+    {0x6405fa00e2ec94d4, 0xdec681f9f4c31f31},
+    {0xde83bc408dd3dd04, 0x8b3c113c38f9f37e},
+    {0x9624ab50b148d445, 0xae0b158b4738705e},
+    {0x3badd624dd9b0957, 0xd98ddaee19068c76},
+    {0xe54ca5d70a80e5d6, 0x87f8a8d4cfa417c9},
+    {0x5e9fcf4ccd211f4c, 0xa9f6d30a038d1dbc},
+    {0x7647c3200069671f, 0xd47487cc8470652b},
+    {0x29ecd9f40041e073, 0x84c8d4dfd2c63f3b},
+    {0xf468107100525890, 0xa5fb0a17c777cf09},
+    {0x7182148d4066eeb4, 0xcf79cc9db955c2cc},
+    {0xc6f14cd848405530, 0x81ac1fe293d599bf},
+    {0xb8ada00e5a506a7c, 0xa21727db38cb002f},
+    {0xa6d90811f0e4851c, 0xca9cf1d206fdc03b},
+    {0x908f4a166d1da663, 0xfd442e4688bd304a},
+    {0x9a598e4e043287fe, 0x9e4a9cec15763e2e},
+    {0x40eff1e1853f29fd, 0xc5dd44271ad3cdba},
+    {0xd12bee59e68ef47c, 0xf7549530e188c128},
+    {0x82bb74f8301958ce, 0x9a94dd3e8cf578b9},
+    {0xe36a52363c1faf01, 0xc13a148e3032d6e7},
+    {0xdc44e6c3cb279ac1, 0xf18899b1bc3f8ca1},
+    {0x29ab103a5ef8c0b9, 0x96f5600f15a7b7e5},
+    {0x7415d448f6b6f0e7, 0xbcb2b812db11a5de},
+    {0x111b495b3464ad21, 0xebdf661791d60f56},
+    {0xcab10dd900beec34, 0x936b9fcebb25c995},
+    {0x3d5d514f40eea742, 0xb84687c269ef3bfb},
+    {0x0cb4a5a3112a5112, 0xe65829b3046b0afa},
+    {0x47f0e785eaba72ab, 0x8ff71a0fe2c2e6dc},
+    {0x59ed216765690f56, 0xb3f4e093db73a093},
+    {0x306869c13ec3532c, 0xe0f218b8d25088b8},
+    {0x1e414218c73a13fb, 0x8c974f7383725573},
+    {0xe5d1929ef90898fa, 0xafbd2350644eeacf},
+    {0xdf45f746b74abf39, 0xdbac6c247d62a583},
+    {0x6b8bba8c328eb783, 0x894bc396ce5da772},
+    {0x066ea92f3f326564, 0xab9eb47c81f5114f},
+    {0xc80a537b0efefebd, 0xd686619ba27255a2},
+    {0xbd06742ce95f5f36, 0x8613fd0145877585},
+    {0x2c48113823b73704, 0xa798fc4196e952e7},
+    {0xf75a15862ca504c5, 0xd17f3b51fca3a7a0},
+    {0x9a984d73dbe722fb, 0x82ef85133de648c4},
+    {0xc13e60d0d2e0ebba, 0xa3ab66580d5fdaf5},
+    {0x318df905079926a8, 0xcc963fee10b7d1b3},
+    {0xfdf17746497f7052, 0xffbbcfe994e5c61f},
+    {0xfeb6ea8bedefa633, 0x9fd561f1fd0f9bd3},
+    {0xfe64a52ee96b8fc0, 0xc7caba6e7c5382c8},
+    {0x3dfdce7aa3c673b0, 0xf9bd690a1b68637b},
+    {0x06bea10ca65c084e, 0x9c1661a651213e2d},
+    {0x486e494fcff30a62, 0xc31bfa0fe5698db8},
+    {0x5a89dba3c3efccfa, 0xf3e2f893dec3f126},
+    {0xf89629465a75e01c, 0x986ddb5c6b3a76b7},
+    {0xf6bbb397f1135823, 0xbe89523386091465},
+    {0x746aa07ded582e2c, 0xee2ba6c0678b597f},
+    {0xa8c2a44eb4571cdc, 0x94db483840b717ef},
+    {0x92f34d62616ce413, 0xba121a4650e4ddeb},
+    {0x77b020baf9c81d17, 0xe896a0d7e51e1566},
+    {0x0ace1474dc1d122e, 0x915e2486ef32cd60},
+    {0x0d819992132456ba, 0xb5b5ada8aaff80b8},
+    {0x10e1fff697ed6c69, 0xe3231912d5bf60e6},
+    {0xca8d3ffa1ef463c1, 0x8df5efabc5979c8f},
+    {0xbd308ff8a6b17cb2, 0xb1736b96b6fd83b3},
+    {0xac7cb3f6d05ddbde, 0xddd0467c64bce4a0},
+    {0x6bcdf07a423aa96b, 0x8aa22c0dbef60ee4},
+    {0x86c16c98d2c953c6, 0xad4ab7112eb3929d},
+    {0xe871c7bf077ba8b7, 0xd89d64d57a607744},
+    {0x11471cd764ad4972, 0x87625f056c7c4a8b},
+    {0xd598e40d3dd89bcf, 0xa93af6c6c79b5d2d},
+    {0x4aff1d108d4ec2c3, 0xd389b47879823479},
+    {0xcedf722a585139ba, 0x843610cb4bf160cb},
+    {0xc2974eb4ee658828, 0xa54394fe1eedb8fe},
+    {0x733d226229feea32, 0xce947a3da6a9273e},
+    {0x0806357d5a3f525f, 0x811ccc668829b887},
+    {0xca07c2dcb0cf26f7, 0xa163ff802a3426a8},
+    {0xfc89b393dd02f0b5, 0xc9bcff6034c13052},
+    {0xbbac2078d443ace2, 0xfc2c3f3841f17c67},
+    {0xd54b944b84aa4c0d, 0x9d9ba7832936edc0},
+    {0x0a9e795e65d4df11, 0xc5029163f384a931},
+    {0x4d4617b5ff4a16d5, 0xf64335bcf065d37d},
+    {0x504bced1bf8e4e45, 0x99ea0196163fa42e},
+    {0xe45ec2862f71e1d6, 0xc06481fb9bcf8d39},
+    {0x5d767327bb4e5a4c, 0xf07da27a82c37088},
+    {0x3a6a07f8d510f86f, 0x964e858c91ba2655},
+    {0x890489f70a55368b, 0xbbe226efb628afea},
+    {0x2b45ac74ccea842e, 0xeadab0aba3b2dbe5},
+    {0x3b0b8bc90012929d, 0x92c8ae6b464fc96f},
+    {0x09ce6ebb40173744, 0xb77ada0617e3bbcb},
+    {0xcc420a6a101d0515, 0xe55990879ddcaabd},
+    {0x9fa946824a12232d, 0x8f57fa54c2a9eab6},
+    {0x47939822dc96abf9, 0xb32df8e9f3546564},
+    {0x59787e2b93bc56f7, 0xdff9772470297ebd},
+    {0x57eb4edb3c55b65a, 0x8bfbea76c619ef36},
+    {0xede622920b6b23f1, 0xaefae51477a06b03},
+    {0xe95fab368e45eced, 0xdab99e59958885c4},
+    {0x11dbcb0218ebb414, 0x88b402f7fd75539b},
+    {0xd652bdc29f26a119, 0xaae103b5fcd2a881},
+    {0x4be76d3346f0495f, 0xd59944a37c0752a2},
+    {0x6f70a4400c562ddb, 0x857fcae62d8493a5},
+    {0xcb4ccd500f6bb952, 0xa6dfbd9fb8e5b88e},
+    {0x7e2000a41346a7a7, 0xd097ad07a71f26b2},
+    {0x8ed400668c0c28c8, 0x825ecc24c873782f},
+    {0x728900802f0f32fa, 0xa2f67f2dfa90563b},
+    {0x4f2b40a03ad2ffb9, 0xcbb41ef979346bca},
+    {0xe2f610c84987bfa8, 0xfea126b7d78186bc},
+    {0x0dd9ca7d2df4d7c9, 0x9f24b832e6b0f436},
+    {0x91503d1c79720dbb, 0xc6ede63fa05d3143},
+    {0x75a44c6397ce912a, 0xf8a95fcf88747d94},
+    {0xc986afbe3ee11aba, 0x9b69dbe1b548ce7c},
+    {0xfbe85badce996168, 0xc24452da229b021b},
+    {0xfae27299423fb9c3, 0xf2d56790ab41c2a2},
+    {0xdccd879fc967d41a, 0x97c560ba6b0919a5},
+    {0x5400e987bbc1c920, 0xbdb6b8e905cb600f},
+    {0x290123e9aab23b68, 0xed246723473e3813},
+    {0xf9a0b6720aaf6521, 0x9436c0760c86e30b},
+    {0xf808e40e8d5b3e69, 0xb94470938fa89bce},
+    {0xb60b1d1230b20e04, 0xe7958cb87392c2c2},
+    {0xb1c6f22b5e6f48c2, 0x90bd77f3483bb9b9},
+    {0x1e38aeb6360b1af3, 0xb4ecd5f01a4aa828},
+    {0x25c6da63c38de1b0, 0xe2280b6c20dd5232},
+    {0x579c487e5a38ad0e, 0x8d590723948a535f},
+    {0x2d835a9df0c6d851, 0xb0af48ec79ace837},
+    {0xf8e431456cf88e65, 0xdcdb1b2798182244},
+    {0x1b8e9ecb641b58ff, 0x8a08f0f8bf0f156b},
+    {0xe272467e3d222f3f, 0xac8b2d36eed2dac5},
+    {0x5b0ed81dcc6abb0f, 0xd7adf884aa879177},
+    {0x98e947129fc2b4e9, 0x86ccbb52ea94baea},
+    {0x3f2398d747b36224, 0xa87fea27a539e9a5},
+    {0x8eec7f0d19a03aad, 0xd29fe4b18e88640e},
+    {0x1953cf68300424ac, 0x83a3eeeef9153e89},
+    {0x5fa8c3423c052dd7, 0xa48ceaaab75a8e2b},
+    {0x3792f412cb06794d, 0xcdb02555653131b6},
+    {0xe2bbd88bbee40bd0, 0x808e17555f3ebf11},
+    {0x5b6aceaeae9d0ec4, 0xa0b19d2ab70e6ed6},
+    {0xf245825a5a445275, 0xc8de047564d20a8b},
+    {0xeed6e2f0f0d56712, 0xfb158592be068d2e},
+    {0x55464dd69685606b, 0x9ced737bb6c4183d},
+    {0xaa97e14c3c26b886, 0xc428d05aa4751e4c},
+    {0xd53dd99f4b3066a8, 0xf53304714d9265df},
+    {0xe546a8038efe4029, 0x993fe2c6d07b7fab},
+    {0xde98520472bdd033, 0xbf8fdb78849a5f96},
+    {0x963e66858f6d4440, 0xef73d256a5c0f77c},
+    {0xdde7001379a44aa8, 0x95a8637627989aad},
+    {0x5560c018580d5d52, 0xbb127c53b17ec159},
+    {0xaab8f01e6e10b4a6, 0xe9d71b689dde71af},
+    {0xcab3961304ca70e8, 0x9226712162ab070d},
+    {0x3d607b97c5fd0d22, 0xb6b00d69bb55c8d1},
+    {0x8cb89a7db77c506a, 0xe45c10c42a2b3b05},
+    {0x77f3608e92adb242, 0x8eb98a7a9a5b04e3},
+    {0x55f038b237591ed3, 0xb267ed1940f1c61c},
+    {0x6b6c46dec52f6688, 0xdf01e85f912e37a3},
+    {0x2323ac4b3b3da015, 0x8b61313bbabce2c6},
+    {0xabec975e0a0d081a, 0xae397d8aa96c1b77},
+    {0x96e7bd358c904a21, 0xd9c7dced53c72255},
+    {0x7e50d64177da2e54, 0x881cea14545c7575},
+    {0xdde50bd1d5d0b9e9, 0xaa242499697392d2},
+    {0x955e4ec64b44e864, 0xd4ad2dbfc3d07787},
+    {0xbd5af13bef0b113e, 0x84ec3c97da624ab4},
+    {0xecb1ad8aeacdd58e, 0xa6274bbdd0fadd61},
+    {0x67de18eda5814af2, 0xcfb11ead453994ba},
+    {0x80eacf948770ced7, 0x81ceb32c4b43fcf4},
+    {0xa1258379a94d028d, 0xa2425ff75e14fc31},
+    {0x096ee45813a04330, 0xcad2f7f5359a3b3e},
+    {0x8bca9d6e188853fc, 0xfd87b5f28300ca0d},
+    {0x775ea264cf55347d, 0x9e74d1b791e07e48},
+    {0x95364afe032a819d, 0xc612062576589dda},
+    {0x3a83ddbd83f52204, 0xf79687aed3eec551},
+    {0xc4926a9672793542, 0x9abe14cd44753b52},
+    {0x75b7053c0f178293, 0xc16d9a0095928a27},
+    {0x5324c68b12dd6338, 0xf1c90080baf72cb1},
+    {0xd3f6fc16ebca5e03, 0x971da05074da7bee},
+    {0x88f4bb1ca6bcf584, 0xbce5086492111aea},
+    {0x2b31e9e3d06c32e5, 0xec1e4a7db69561a5},
+    {0x3aff322e62439fcf, 0x9392ee8e921d5d07},
+    {0x09befeb9fad487c2, 0xb877aa3236a4b449},
+    {0x4c2ebe687989a9b3, 0xe69594bec44de15b},
+    {0x0f9d37014bf60a10, 0x901d7cf73ab0acd9},
+    {0x538484c19ef38c94, 0xb424dc35095cd80f},
+    {0x2865a5f206b06fb9, 0xe12e13424bb40e13},
+    {0xf93f87b7442e45d3, 0x8cbccc096f5088cb},
+    {0xf78f69a51539d748, 0xafebff0bcb24aafe},
+    {0xb573440e5a884d1b, 0xdbe6fecebdedd5be},
+    {0x31680a88f8953030, 0x89705f4136b4a597},
+    {0xfdc20d2b36ba7c3d, 0xabcc77118461cefc},
+    {0x3d32907604691b4c, 0xd6bf94d5e57a42bc},
+    {0xa63f9a49c2c1b10f, 0x8637bd05af6c69b5},
+    {0x0fcf80dc33721d53, 0xa7c5ac471b478423},
+    {0xd3c36113404ea4a8, 0xd1b71758e219652b},
+    {0x645a1cac083126e9, 0x83126e978d4fdf3b},
+    {0x3d70a3d70a3d70a3, 0xa3d70a3d70a3d70a},
+    {0xcccccccccccccccc, 0xcccccccccccccccc},
+    {0x0000000000000000, 0x8000000000000000},
+    {0x0000000000000000, 0xa000000000000000},
+    {0x0000000000000000, 0xc800000000000000},
+    {0x0000000000000000, 0xfa00000000000000},
+    {0x0000000000000000, 0x9c40000000000000},
+    {0x0000000000000000, 0xc350000000000000},
+    {0x0000000000000000, 0xf424000000000000},
+    {0x0000000000000000, 0x9896800000000000},
+    {0x0000000000000000, 0xbebc200000000000},
+    {0x0000000000000000, 0xee6b280000000000},
+    {0x0000000000000000, 0x9502f90000000000},
+    {0x0000000000000000, 0xba43b74000000000},
+    {0x0000000000000000, 0xe8d4a51000000000},
+    {0x0000000000000000, 0x9184e72a00000000},
+    {0x0000000000000000, 0xb5e620f480000000},
+    {0x0000000000000000, 0xe35fa931a0000000},
+    {0x0000000000000000, 0x8e1bc9bf04000000},
+    {0x0000000000000000, 0xb1a2bc2ec5000000},
+    {0x0000000000000000, 0xde0b6b3a76400000},
+    {0x0000000000000000, 0x8ac7230489e80000},
+    {0x0000000000000000, 0xad78ebc5ac620000},
+    {0x0000000000000000, 0xd8d726b7177a8000},
+    {0x0000000000000000, 0x878678326eac9000},
+    {0x0000000000000000, 0xa968163f0a57b400},
+    {0x0000000000000000, 0xd3c21bcecceda100},
+    {0x0000000000000000, 0x84595161401484a0},
+    {0x0000000000000000, 0xa56fa5b99019a5c8},
+    {0x0000000000000000, 0xcecb8f27f4200f3a},
+    {0x4000000000000000, 0x813f3978f8940984},
+    {0x5000000000000000, 0xa18f07d736b90be5},
+    {0xa400000000000000, 0xc9f2c9cd04674ede},
+    {0x4d00000000000000, 0xfc6f7c4045812296},
+    {0xf020000000000000, 0x9dc5ada82b70b59d},
+    {0x6c28000000000000, 0xc5371912364ce305},
+    {0xc732000000000000, 0xf684df56c3e01bc6},
+    {0x3c7f400000000000, 0x9a130b963a6c115c},
+    {0x4b9f100000000000, 0xc097ce7bc90715b3},
+    {0x1e86d40000000000, 0xf0bdc21abb48db20},
+    {0x1314448000000000, 0x96769950b50d88f4},
+    {0x17d955a000000000, 0xbc143fa4e250eb31},
+    {0x5dcfab0800000000, 0xeb194f8e1ae525fd},
+    {0x5aa1cae500000000, 0x92efd1b8d0cf37be},
+    {0xf14a3d9e40000000, 0xb7abc627050305ad},
+    {0x6d9ccd05d0000000, 0xe596b7b0c643c719},
+    {0xe4820023a2000000, 0x8f7e32ce7bea5c6f},
+    {0xdda2802c8a800000, 0xb35dbf821ae4f38b},
+    {0xd50b2037ad200000, 0xe0352f62a19e306e},
+    {0x4526f422cc340000, 0x8c213d9da502de45},
+    {0x9670b12b7f410000, 0xaf298d050e4395d6},
+    {0x3c0cdd765f114000, 0xdaf3f04651d47b4c},
+    {0xa5880a69fb6ac800, 0x88d8762bf324cd0f},
+    {0x8eea0d047a457a00, 0xab0e93b6efee0053},
+    {0x72a4904598d6d880, 0xd5d238a4abe98068},
+    {0x47a6da2b7f864750, 0x85a36366eb71f041},
+    {0x999090b65f67d924, 0xa70c3c40a64e6c51},
+    {0xfff4b4e3f741cf6d, 0xd0cf4b50cfe20765},
+    {0xbff8f10e7a8921a4, 0x82818f1281ed449f},
+    {0xaff72d52192b6a0d, 0xa321f2d7226895c7},
+    {0x9bf4f8a69f764490, 0xcbea6f8ceb02bb39},
+    {0x02f236d04753d5b4, 0xfee50b7025c36a08},
+    {0x01d762422c946590, 0x9f4f2726179a2245},
+    {0x424d3ad2b7b97ef5, 0xc722f0ef9d80aad6},
+    {0xd2e0898765a7deb2, 0xf8ebad2b84e0d58b},
+    {0x63cc55f49f88eb2f, 0x9b934c3b330c8577},
+    {0x3cbf6b71c76b25fb, 0xc2781f49ffcfa6d5},
+    {0x8bef464e3945ef7a, 0xf316271c7fc3908a},
+    {0x97758bf0e3cbb5ac, 0x97edd871cfda3a56},
+    {0x3d52eeed1cbea317, 0xbde94e8e43d0c8ec},
+    {0x4ca7aaa863ee4bdd, 0xed63a231d4c4fb27},
+    {0x8fe8caa93e74ef6a, 0x945e455f24fb1cf8},
+    {0xb3e2fd538e122b44, 0xb975d6b6ee39e436},
+    {0x60dbbca87196b616, 0xe7d34c64a9c85d44},
+    {0xbc8955e946fe31cd, 0x90e40fbeea1d3a4a},
+    {0x6babab6398bdbe41, 0xb51d13aea4a488dd},
+    {0xc696963c7eed2dd1, 0xe264589a4dcdab14},
+    {0xfc1e1de5cf543ca2, 0x8d7eb76070a08aec},
+    {0x3b25a55f43294bcb, 0xb0de65388cc8ada8},
+    {0x49ef0eb713f39ebe, 0xdd15fe86affad912},
+    {0x6e3569326c784337, 0x8a2dbf142dfcc7ab},
+    {0x49c2c37f07965404, 0xacb92ed9397bf996},
+    {0xdc33745ec97be906, 0xd7e77a8f87daf7fb},
+    {0x69a028bb3ded71a3, 0x86f0ac99b4e8dafd},
+    {0xc40832ea0d68ce0c, 0xa8acd7c0222311bc},
+    {0xf50a3fa490c30190, 0xd2d80db02aabd62b},
+    {0x792667c6da79e0fa, 0x83c7088e1aab65db},
+    {0x577001b891185938, 0xa4b8cab1a1563f52},
+    {0xed4c0226b55e6f86, 0xcde6fd5e09abcf26},
+    {0x544f8158315b05b4, 0x80b05e5ac60b6178},
+    {0x696361ae3db1c721, 0xa0dc75f1778e39d6},
+    {0x03bc3a19cd1e38e9, 0xc913936dd571c84c},
+    {0x04ab48a04065c723, 0xfb5878494ace3a5f},
+    {0x62eb0d64283f9c76, 0x9d174b2dcec0e47b},
+    {0x3ba5d0bd324f8394, 0xc45d1df942711d9a},
+    {0xca8f44ec7ee36479, 0xf5746577930d6500},
+    {0x7e998b13cf4e1ecb, 0x9968bf6abbe85f20},
+    {0x9e3fedd8c321a67e, 0xbfc2ef456ae276e8},
+    {0xc5cfe94ef3ea101e, 0xefb3ab16c59b14a2},
+    {0xbba1f1d158724a12, 0x95d04aee3b80ece5},
+    {0x2a8a6e45ae8edc97, 0xbb445da9ca61281f},
+    {0xf52d09d71a3293bd, 0xea1575143cf97226},
+    {0x593c2626705f9c56, 0x924d692ca61be758},
+    {0x6f8b2fb00c77836c, 0xb6e0c377cfa2e12e},
+    {0x0b6dfb9c0f956447, 0xe498f455c38b997a},
+    {0x4724bd4189bd5eac, 0x8edf98b59a373fec},
+    {0x58edec91ec2cb657, 0xb2977ee300c50fe7},
+    {0x2f2967b66737e3ed, 0xdf3d5e9bc0f653e1},
+    {0xbd79e0d20082ee74, 0x8b865b215899f46c},
+    {0xecd8590680a3aa11, 0xae67f1e9aec07187},
+    {0xe80e6f4820cc9495, 0xda01ee641a708de9},
+    {0x3109058d147fdcdd, 0x884134fe908658b2},
+    {0xbd4b46f0599fd415, 0xaa51823e34a7eede},
+    {0x6c9e18ac7007c91a, 0xd4e5e2cdc1d1ea96},
+    {0x03e2cf6bc604ddb0, 0x850fadc09923329e},
+    {0x84db8346b786151c, 0xa6539930bf6bff45},
+    {0xe612641865679a63, 0xcfe87f7cef46ff16},
+    {0x4fcb7e8f3f60c07e, 0x81f14fae158c5f6e},
+    {0xe3be5e330f38f09d, 0xa26da3999aef7749},
+    {0x5cadf5bfd3072cc5, 0xcb090c8001ab551c},
+    {0x73d9732fc7c8f7f6, 0xfdcb4fa002162a63},
+    {0x2867e7fddcdd9afa, 0x9e9f11c4014dda7e},
+    {0xb281e1fd541501b8, 0xc646d63501a1511d},
+    {0x1f225a7ca91a4226, 0xf7d88bc24209a565},
+    {0x3375788de9b06958, 0x9ae757596946075f},
+    {0x0052d6b1641c83ae, 0xc1a12d2fc3978937},
+    {0xc0678c5dbd23a49a, 0xf209787bb47d6b84},
+    {0xf840b7ba963646e0, 0x9745eb4d50ce6332},
+    {0xb650e5a93bc3d898, 0xbd176620a501fbff},
+    {0xa3e51f138ab4cebe, 0xec5d3fa8ce427aff},
+    {0xc66f336c36b10137, 0x93ba47c980e98cdf},
+    {0xb80b0047445d4184, 0xb8a8d9bbe123f017},
+    {0xa60dc059157491e5, 0xe6d3102ad96cec1d},
+    {0x87c89837ad68db2f, 0x9043ea1ac7e41392},
+    {0x29babe4598c311fb, 0xb454e4a179dd1877},
+    {0xf4296dd6fef3d67a, 0xe16a1dc9d8545e94},
+    {0x1899e4a65f58660c, 0x8ce2529e2734bb1d},
+    {0x5ec05dcff72e7f8f, 0xb01ae745b101e9e4},
+    {0x76707543f4fa1f73, 0xdc21a1171d42645d},
+    {0x6a06494a791c53a8, 0x899504ae72497eba},
+    {0x0487db9d17636892, 0xabfa45da0edbde69},
+    {0x45a9d2845d3c42b6, 0xd6f8d7509292d603},
+    {0x0b8a2392ba45a9b2, 0x865b86925b9bc5c2},
+    {0x8e6cac7768d7141e, 0xa7f26836f282b732},
+    {0x3207d795430cd926, 0xd1ef0244af2364ff},
+    {0x7f44e6bd49e807b8, 0x8335616aed761f1f},
+    {0x5f16206c9c6209a6, 0xa402b9c5a8d3a6e7},
+    {0x36dba887c37a8c0f, 0xcd036837130890a1},
+    {0xc2494954da2c9789, 0x802221226be55a64},
+    {0xf2db9baa10b7bd6c, 0xa02aa96b06deb0fd},
+    {0x6f92829494e5acc7, 0xc83553c5c8965d3d},
+    {0xcb772339ba1f17f9, 0xfa42a8b73abbf48c},
+    {0xff2a760414536efb, 0x9c69a97284b578d7},
+    {0xfef5138519684aba, 0xc38413cf25e2d70d},
+    {0x7eb258665fc25d69, 0xf46518c2ef5b8cd1},
+    {0xef2f773ffbd97a61, 0x98bf2f79d5993802},
+    {0xaafb550ffacfd8fa, 0xbeeefb584aff8603},
+    {0x95ba2a53f983cf38, 0xeeaaba2e5dbf6784},
+    {0xdd945a747bf26183, 0x952ab45cfa97a0b2},
+    {0x94f971119aeef9e4, 0xba756174393d88df},
+    {0x7a37cd5601aab85d, 0xe912b9d1478ceb17},
+    {0xac62e055c10ab33a, 0x91abb422ccb812ee},
+    {0x577b986b314d6009, 0xb616a12b7fe617aa},
+    {0xed5a7e85fda0b80b, 0xe39c49765fdf9d94},
+    {0x14588f13be847307, 0x8e41ade9fbebc27d},
+    {0x596eb2d8ae258fc8, 0xb1d219647ae6b31c},
+    {0x6fca5f8ed9aef3bb, 0xde469fbd99a05fe3},
+    {0x25de7bb9480d5854, 0x8aec23d680043bee},
+    {0xaf561aa79a10ae6a, 0xada72ccc20054ae9},
+    {0x1b2ba1518094da04, 0xd910f7ff28069da4},
+    {0x90fb44d2f05d0842, 0x87aa9aff79042286},
+    {0x353a1607ac744a53, 0xa99541bf57452b28},
+    {0x42889b8997915ce8, 0xd3fa922f2d1675f2},
+    {0x69956135febada11, 0x847c9b5d7c2e09b7},
+    {0x43fab9837e699095, 0xa59bc234db398c25},
+    {0x94f967e45e03f4bb, 0xcf02b2c21207ef2e},
+    {0x1d1be0eebac278f5, 0x8161afb94b44f57d},
+    {0x6462d92a69731732, 0xa1ba1ba79e1632dc},
+    {0x7d7b8f7503cfdcfe, 0xca28a291859bbf93},
+    {0x5cda735244c3d43e, 0xfcb2cb35e702af78},
+    {0x3a0888136afa64a7, 0x9defbf01b061adab},
+    {0x088aaa1845b8fdd0, 0xc56baec21c7a1916},
+    {0x8aad549e57273d45, 0xf6c69a72a3989f5b},
+    {0x36ac54e2f678864b, 0x9a3c2087a63f6399},
+    {0x84576a1bb416a7dd, 0xc0cb28a98fcf3c7f},
+    {0x656d44a2a11c51d5, 0xf0fdf2d3f3c30b9f},
+    {0x9f644ae5a4b1b325, 0x969eb7c47859e743},
+    {0x873d5d9f0dde1fee, 0xbc4665b596706114},
+    {0xa90cb506d155a7ea, 0xeb57ff22fc0c7959},
+    {0x09a7f12442d588f2, 0x9316ff75dd87cbd8},
+    {0x0c11ed6d538aeb2f, 0xb7dcbf5354e9bece},
+    {0x8f1668c8a86da5fa, 0xe5d3ef282a242e81},
+    {0xf96e017d694487bc, 0x8fa475791a569d10},
+    {0x37c981dcc395a9ac, 0xb38d92d760ec4455},
+    {0x85bbe253f47b1417, 0xe070f78d3927556a},
+    {0x93956d7478ccec8e, 0x8c469ab843b89562},
+    {0x387ac8d1970027b2, 0xaf58416654a6babb},
+    {0x06997b05fcc0319e, 0xdb2e51bfe9d0696a},
+    {0x441fece3bdf81f03, 0x88fcf317f22241e2},
+    {0xd527e81cad7626c3, 0xab3c2fddeeaad25a},
+    {0x8a71e223d8d3b074, 0xd60b3bd56a5586f1},
+    {0xf6872d5667844e49, 0x85c7056562757456},
+    {0xb428f8ac016561db, 0xa738c6bebb12d16c},
+    {0xe13336d701beba52, 0xd106f86e69d785c7},
+    {0xecc0024661173473, 0x82a45b450226b39c},
+    {0x27f002d7f95d0190, 0xa34d721642b06084},
+    {0x31ec038df7b441f4, 0xcc20ce9bd35c78a5},
+    {0x7e67047175a15271, 0xff290242c83396ce},
+    {0x0f0062c6e984d386, 0x9f79a169bd203e41},
+    {0x52c07b78a3e60868, 0xc75809c42c684dd1},
+    {0xa7709a56ccdf8a82, 0xf92e0c3537826145},
+    {0x88a66076400bb691, 0x9bbcc7a142b17ccb},
+    {0x6acff893d00ea435, 0xc2abf989935ddbfe},
+    {0x0583f6b8c4124d43, 0xf356f7ebf83552fe},
+    {0xc3727a337a8b704a, 0x98165af37b2153de},
+    {0x744f18c0592e4c5c, 0xbe1bf1b059e9a8d6},
+    {0x1162def06f79df73, 0xeda2ee1c7064130c},
+    {0x8addcb5645ac2ba8, 0x9485d4d1c63e8be7},
+    {0x6d953e2bd7173692, 0xb9a74a0637ce2ee1},
+    {0xc8fa8db6ccdd0437, 0xe8111c87c5c1ba99},
+    {0x1d9c9892400a22a2, 0x910ab1d4db9914a0},
+    {0x2503beb6d00cab4b, 0xb54d5e4a127f59c8},
+    {0x2e44ae64840fd61d, 0xe2a0b5dc971f303a},
+    {0x5ceaecfed289e5d2, 0x8da471a9de737e24},
+    {0x7425a83e872c5f47, 0xb10d8e1456105dad},
+    {0xd12f124e28f77719, 0xdd50f1996b947518},
+    {0x82bd6b70d99aaa6f, 0x8a5296ffe33cc92f},
+    {0x636cc64d1001550b, 0xace73cbfdc0bfb7b},
+    {0x3c47f7e05401aa4e, 0xd8210befd30efa5a},
+    {0x65acfaec34810a71, 0x8714a775e3e95c78},
+    {0x7f1839a741a14d0d, 0xa8d9d1535ce3b396},
+    {0x1ede48111209a050, 0xd31045a8341ca07c},
+    {0x934aed0aab460432, 0x83ea2b892091e44d},
+    {0xf81da84d5617853f, 0xa4e4b66b68b65d60},
+    {0x36251260ab9d668e, 0xce1de40642e3f4b9},
+    {0xc1d72b7c6b426019, 0x80d2ae83e9ce78f3},
+    {0xb24cf65b8612f81f, 0xa1075a24e4421730},
+    {0xdee033f26797b627, 0xc94930ae1d529cfc},
+    {0x169840ef017da3b1, 0xfb9b7cd9a4a7443c},
+    {0x8e1f289560ee864e, 0x9d412e0806e88aa5},
+    {0xf1a6f2bab92a27e2, 0xc491798a08a2ad4e},
+    {0xae10af696774b1db, 0xf5b5d7ec8acb58a2},
+    {0xacca6da1e0a8ef29, 0x9991a6f3d6bf1765},
+    {0x17fd090a58d32af3, 0xbff610b0cc6edd3f},
+    {0xddfc4b4cef07f5b0, 0xeff394dcff8a948e},
+    {0x4abdaf101564f98e, 0x95f83d0a1fb69cd9},
+    {0x9d6d1ad41abe37f1, 0xbb764c4ca7a4440f},
+    {0x84c86189216dc5ed, 0xea53df5fd18d5513},
+    {0x32fd3cf5b4e49bb4, 0x92746b9be2f8552c},
+    {0x3fbc8c33221dc2a1, 0xb7118682dbb66a77},
+    {0x0fabaf3feaa5334a, 0xe4d5e82392a40515},
+    {0x29cb4d87f2a7400e, 0x8f05b1163ba6832d},
+    {0x743e20e9ef511012, 0xb2c71d5bca9023f8},
+    {0x914da9246b255416, 0xdf78e4b2bd342cf6},
+    {0x1ad089b6c2f7548e, 0x8bab8eefb6409c1a},
+    {0xa184ac2473b529b1, 0xae9672aba3d0c320},
+    {0xc9e5d72d90a2741e, 0xda3c0f568cc4f3e8},
+    {0x7e2fa67c7a658892, 0x8865899617fb1871},
+    {0xddbb901b98feeab7, 0xaa7eebfb9df9de8d},
+    {0x552a74227f3ea565, 0xd51ea6fa85785631},
+    {0xd53a88958f87275f, 0x8533285c936b35de},
+    {0x8a892abaf368f137, 0xa67ff273b8460356},
+    {0x2d2b7569b0432d85, 0xd01fef10a657842c},
+    {0x9c3b29620e29fc73, 0x8213f56a67f6b29b},
+    {0x8349f3ba91b47b8f, 0xa298f2c501f45f42},
+    {0x241c70a936219a73, 0xcb3f2f7642717713},
+    {0xed238cd383aa0110, 0xfe0efb53d30dd4d7},
+    {0xf4363804324a40aa, 0x9ec95d1463e8a506},
+    {0xb143c6053edcd0d5, 0xc67bb4597ce2ce48},
+    {0xdd94b7868e94050a, 0xf81aa16fdc1b81da},
+    {0xca7cf2b4191c8326, 0x9b10a4e5e9913128},
+    {0xfd1c2f611f63a3f0, 0xc1d4ce1f63f57d72},
+    {0xbc633b39673c8cec, 0xf24a01a73cf2dccf},
+    {0xd5be0503e085d813, 0x976e41088617ca01},
+    {0x4b2d8644d8a74e18, 0xbd49d14aa79dbc82},
+    {0xddf8e7d60ed1219e, 0xec9c459d51852ba2},
+    {0xcabb90e5c942b503, 0x93e1ab8252f33b45},
+    {0x3d6a751f3b936243, 0xb8da1662e7b00a17},
+    {0x0cc512670a783ad4, 0xe7109bfba19c0c9d},
+    {0x27fb2b80668b24c5, 0x906a617d450187e2},
+    {0xb1f9f660802dedf6, 0xb484f9dc9641e9da},
+    {0x5e7873f8a0396973, 0xe1a63853bbd26451},
+    {0xdb0b487b6423e1e8, 0x8d07e33455637eb2},
+    {0x91ce1a9a3d2cda62, 0xb049dc016abc5e5f},
+    {0x7641a140cc7810fb, 0xdc5c5301c56b75f7},
+    {0xa9e904c87fcb0a9d, 0x89b9b3e11b6329ba},
+    {0x546345fa9fbdcd44, 0xac2820d9623bf429},
+    {0xa97c177947ad4095, 0xd732290fbacaf133},
+    {0x49ed8eabcccc485d, 0x867f59a9d4bed6c0},
+    {0x5c68f256bfff5a74, 0xa81f301449ee8c70},
+    {0x73832eec6fff3111, 0xd226fc195c6a2f8c},
+    {0xc831fd53c5ff7eab, 0x83585d8fd9c25db7},
+    {0xba3e7ca8b77f5e55, 0xa42e74f3d032f525},
+    {0x28ce1bd2e55f35eb, 0xcd3a1230c43fb26f},
+    {0x7980d163cf5b81b3, 0x80444b5e7aa7cf85},
+    {0xd7e105bcc332621f, 0xa0555e361951c366},
+    {0x8dd9472bf3fefaa7, 0xc86ab5c39fa63440},
+    {0xb14f98f6f0feb951, 0xfa856334878fc150},
+    {0x6ed1bf9a569f33d3, 0x9c935e00d4b9d8d2},
+    {0x0a862f80ec4700c8, 0xc3b8358109e84f07},
+    {0xcd27bb612758c0fa, 0xf4a642e14c6262c8},
+    {0x8038d51cb897789c, 0x98e7e9cccfbd7dbd},
+    {0xe0470a63e6bd56c3, 0xbf21e44003acdd2c},
+    {0x1858ccfce06cac74, 0xeeea5d5004981478},
+    {0x0f37801e0c43ebc8, 0x95527a5202df0ccb},
+    {0xd30560258f54e6ba, 0xbaa718e68396cffd},
+    {0x47c6b82ef32a2069, 0xe950df20247c83fd},
+    {0x4cdc331d57fa5441, 0x91d28b7416cdd27e},
+    {0xe0133fe4adf8e952, 0xb6472e511c81471d},
+    {0x58180fddd97723a6, 0xe3d8f9e563a198e5},
+    {0x570f09eaa7ea7648, 0x8e679c2f5e44ff8f},
+    {0x2cd2cc6551e513da, 0xb201833b35d63f73},
+    {0xf8077f7ea65e58d1, 0xde81e40a034bcf4f},
+    {0xfb04afaf27faf782, 0x8b112e86420f6191},
+    {0x79c5db9af1f9b563, 0xadd57a27d29339f6},
+    {0x18375281ae7822bc, 0xd94ad8b1c7380874},
+    {0x8f2293910d0b15b5, 0x87cec76f1c830548},
+    {0xb2eb3875504ddb22, 0xa9c2794ae3a3c69a},
+    {0x5fa60692a46151eb, 0xd433179d9c8cb841},
+    {0xdbc7c41ba6bcd333, 0x849feec281d7f328},
+    {0x12b9b522906c0800, 0xa5c7ea73224deff3},
+    {0xd768226b34870a00, 0xcf39e50feae16bef},
+    {0xe6a1158300d46640, 0x81842f29f2cce375},
+    {0x60495ae3c1097fd0, 0xa1e53af46f801c53},
+    {0x385bb19cb14bdfc4, 0xca5e89b18b602368},
+    {0x46729e03dd9ed7b5, 0xfcf62c1dee382c42},
+    {0x6c07a2c26a8346d1, 0x9e19db92b4e31ba9},
+    {0xc7098b7305241885, 0xc5a05277621be293},
+    {0xb8cbee4fc66d1ea7, 0xf70867153aa2db38},
+    {0x737f74f1dc043328, 0x9a65406d44a5c903},
+    {0x505f522e53053ff2, 0xc0fe908895cf3b44},
+    {0x647726b9e7c68fef, 0xf13e34aabb430a15},
+    {0x5eca783430dc19f5, 0x96c6e0eab509e64d},
+    {0xb67d16413d132072, 0xbc789925624c5fe0},
+    {0xe41c5bd18c57e88f, 0xeb96bf6ebadf77d8},
+    {0x8e91b962f7b6f159, 0x933e37a534cbaae7},
+    {0x723627bbb5a4adb0, 0xb80dc58e81fe95a1},
+    {0xcec3b1aaa30dd91c, 0xe61136f2227e3b09},
+    {0x213a4f0aa5e8a7b1, 0x8fcac257558ee4e6},
+    {0xa988e2cd4f62d19d, 0xb3bd72ed2af29e1f},
+    {0x93eb1b80a33b8605, 0xe0accfa875af45a7},
+    {0xbc72f130660533c3, 0x8c6c01c9498d8b88},
+    {0xeb8fad7c7f8680b4, 0xaf87023b9bf0ee6a},
+    {0xa67398db9f6820e1, 0xdb68c2ca82ed2a05},
+    {0x88083f8943a1148c, 0x892179be91d43a43},
+    {0x6a0a4f6b948959b0, 0xab69d82e364948d4},
+    {0x848ce34679abb01c, 0xd6444e39c3db9b09},
+    {0xf2d80e0c0c0b4e11, 0x85eab0e41a6940e5},
+    {0x6f8e118f0f0e2195, 0xa7655d1d2103911f},
+    {0x4b7195f2d2d1a9fb, 0xd13eb46469447567},
+};
+
+static const isize DECIMAL_DIGITS = 800;
+static const isize DECIMAL_SHIFT  = 60;
+
+static const u8 DECIMAL_POW_2[9] = {
+    1, 3, 6, 9, 13, 16, 19, 23, 26,
+};
+
+typedef struct {
+    u8    digits[DECIMAL_DIGITS];
+    isize count;
+    isize point;
+    bool  truncated;
+} Decimal;
+
+static void decimal_trim(Decimal* self)
+{
+    while (self->count > 0 && self->digits[self->count - 1] == 0)
+        self->count -= 1;
+
+    if (self->count == 0) self->point = 0;
+}
+
+static void decimal_shift_left(Decimal* self, isize count)
+{
+    u8    temp[DECIMAL_DIGITS + 20];
+    isize write = DECIMAL_DIGITS + 20;
+    u64   value = 0;
+
+    for (isize i = self->count - 1; i >= 0; i -= 1) {
+        value += (u64)(self->digits[i]) << count;
+
+        write -= 1;
+
+        temp[write] = (u8)(value % 10);
+        value       = value / 10;
+    }
+
+    while (value != 0) {
+        write -= 1;
+
+        temp[write] = (u8)(value % 10);
+        value       = value / 10;
+    }
+
+    isize units = DECIMAL_DIGITS + 20 - write;
+
+    self->point += units - self->count;
+    self->count  = PAX_MIN(units, DECIMAL_DIGITS);
+
+    for (isize i = 0; i < self->count; i += 1)
+        self->digits[i] = temp[write + i];
+
+    for (isize i = self->count; i < units; i += 1) {
+        if (temp[write + i] != 0)
+            self->truncated = true;
+    }
+
+    decimal_trim(self);
+}
+
+static void decimal_shift_right(Decimal* self, isize count)
+{
+    isize read  = 0;
+    isize write = 0;
+    u64   value = 0;
+    u64   mask  = ((u64)(1) << count) - 1;
+
+    while ((value >> count) == 0) {
+        if (read >= self->count) {
+            if (value == 0) {
+                self->count = 0;
+                self->point = 0;
+
+                return;
+            }
+
+            while ((value >> count) == 0) {
+                value *= 10;
+                read  += 1;
+            }
+
+            break;
+        }
+
+        value = value * 10 + self->digits[read];
+        read += 1;
+    }
+
+    self->point -= read - 1;
+
+    while (read < self->count) {
+        u8 digit = (u8)(value >> count);
+
+        value &= mask;
+
+        self->digits[write] = digit;
+
+        write += 1;
+        value  = value * 10 + self->digits[read];
+        read  += 1;
+    }
+
+    while (value != 0) {
+        u8 digit = (u8)(value >> count);
+
+        value &= mask;
+
+        if (write < DECIMAL_DIGITS) {
+            self->digits[write] = digit;
+
+            write += 1;
+        } else if (digit != 0)
+            self->truncated = true;
+
+        value *= 10;
+    }
+
+    self->count = write;
+
+    decimal_trim(self);
+}
+
+static void decimal_shift(Decimal* self, isize count)
+{
+    if (self->count == 0) return;
+
+    while (count > DECIMAL_SHIFT) {
+        decimal_shift_left(self, DECIMAL_SHIFT);
+
+        count -= DECIMAL_SHIFT;
+    }
+
+    while (count < -DECIMAL_SHIFT) {
+        decimal_shift_right(self, DECIMAL_SHIFT);
+
+        count += DECIMAL_SHIFT;
+    }
+
+    if (count > 0) decimal_shift_left(self, count);
+    if (count < 0) decimal_shift_right(self, -count);
+}
+
+static bool decimal_round_up(Decimal* self, isize index)
+{
+    if (index < 0 || index >= self->count) return false;
+
+    if (self->digits[index] == 5 && index + 1 == self->count) {
+        if (self->truncated == true) return true;
+
+        return index > 0 && self->digits[index - 1] % 2 != 0;
+    }
+
+    return self->digits[index] >= 5;
+}
+
+static u64 decimal_to_u64(Decimal* self)
+{
+    u64   result = 0;
+    isize index  = 0;
+
+    if (self->point > 20) return (u64)(-1);
+
+    while (index < self->point && index < self->count) {
+        result = result * 10 + self->digits[index];
+        index += 1;
+    }
+
+    while (index < self->point) {
+        result *= 10;
+        index  += 1;
+    }
+
+    if (decimal_round_up(self, self->point) == true)
+        result += 1;
+
+    return result;
+}
+
+static u64 decimal_to_f64_bits(Decimal* self, bool* overflow)
+{
+    isize exponent = 0;
+    u64   mantissa = 0;
+
+    *overflow = false;
+
+    if (self->count == 0 || self->point < -330) return 0;
+
+    if (self->point > 310) {
+        *overflow = true;
+
+        return (u64)(0x7ff) << 52;
+    }
+
+    while (self->point > 0) {
+        isize count = 27;
+
+        if (self->point < (isize)(PAX_ARRAY_ITEMS(DECIMAL_POW_2)))
+            count = DECIMAL_POW_2[self->point];
+
+        decimal_shift(self, -count);
+
+        exponent += count;
+    }
+
+    while (self->point < 0 || (self->point == 0 && self->digits[0] < 5)) {
+        isize count = 27;
+
+        if (-self->point < (isize)(PAX_ARRAY_ITEMS(DECIMAL_POW_2)))
+            count = DECIMAL_POW_2[-self->point];
+
+        decimal_shift(self, count);
+
+        exponent -= count;
+    }
+
+    exponent -= 1;
+
+    if (exponent < -1022) {
+        decimal_shift(self, exponent + 1022);
+
+        exponent = -1022;
+    }
+
+    if (exponent + 1023 >= 0x7ff) {
+        *overflow = true;
+
+        return (u64)(0x7ff) << 52;
+    }
+
+    decimal_shift(self, 53);
+
+    mantissa = decimal_to_u64(self);
+
+    if (mantissa == (u64)(2) << 52) {
+        mantissa >>= 1;
+        exponent  += 1;
+
+        if (exponent + 1023 >= 0x7ff) {
+            *overflow = true;
+
+            return (u64)(0x7ff) << 52;
+        }
+    }
+
+    if ((mantissa & ((u64)(1) << 52)) == 0)
+        exponent = -1023;
+
+    return (mantissa & (((u64)(1) << 52) - 1)) |
+        ((u64)((exponent + 1023) & 0x7ff) << 52);
+}
+
+static bool parse_is_eight_digits(u64 word)
+{
+    u64 high = word & 0xf0f0f0f0f0f0f0f0;
+    u64 over = (word + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0;
+
+    return (high | (over >> 4)) == 0x3333333333333333;
+}
+
+static u64 parse_eight_digits(u64 word)
+{
+    word -= 0x3030303030303030;
+    word  = word * 10 + (word >> 8);
+
+    u64 low  = (word         & 0x000000ff000000ff) * (100 + ((u64)(1000000) << 32));
+    u64 high = ((word >> 16) & 0x000000ff000000ff) * (1   + ((u64)(10000)   << 32));
+
+    return (low + high) >> 32;
+}
+
+static bool parse_eisel_lemire(u64 mantissa, isize exponent, u64* bits)
+{
+    if (exponent < PARSE_POW_10_MIN || exponent > PARSE_POW_10_MAX)
+        return false;
+
+    const u64* power = PARSE_POW_10_WIDE[exponent - PARSE_POW_10_MIN];
+
+    isize zeros = bits_count_leading(mantissa);
+
+    mantissa <<= zeros;
+
+    u64 result = (u64)(((217706 * exponent) >> 16) + 64 + 1023 - zeros);
+    u64 high   = 0;
+    u64 low    = bits_mul_u128(mantissa, power[1], &high);
+
+    if ((high & 0x1ff) == 0x1ff && low + mantissa < mantissa) {
+        u64 other_high = 0;
+        u64 other_low  = bits_mul_u128(mantissa, power[0], &other_high);
+
+        u64 merged_high = high;
+        u64 merged_low  = low + other_high;
+
+        if (merged_low < low) merged_high += 1;
+
+        if ((merged_high & 0x1ff) == 0x1ff && merged_low + 1 == 0 && other_low + mantissa < mantissa)
+            return false;
+
+        high = merged_high;
+        low  = merged_low;
+    }
+
+    u64 top   = high >> 63;
+    u64 value = high >> (top + 9);
+
+    result -= 1 ^ top;
+
+    if (low == 0 && (high & 0x1ff) == 0 && (value & 3) == 1)
+        return false;
+
+    value += value & 1;
+    value >>= 1;
+
+    if ((value >> 53) > 0) {
+        value  >>= 1;
+        result  += 1;
+    }
+
+    if (result - 1 >= 0x7ff - 1) return false;
+
+    *bits = (result << 52) | (value & (((u64)(1) << 52) - 1));
+
+    return true;
+}
+
+static bool parse_is_word(String_8 self, isize index, String_8 word)
+{
+    if (word.length > self.length - index) return false;
+
+    for (isize i = 0; i < word.length; i += 1) {
+        if ((self.memory[index + i] | 0x20) != word.memory[i])
+            return false;
+    }
+
+    return true;
+}
+
+Parse_U64 str8_parse_u64(String_8 self, isize index)
+{
+    Parse_U64 result = {};
+
+    isize start = index;
+    u64   value = 0;
+
+    if (index < 0 || index > self.length) {
+        result.error = PARSE_ERROR_OUT_OF_BOUNDS;
+
+        return result;
+    }
+
+    if (index < self.length && self.memory[index] == '+')
+        index += 1;
+
+    isize first = index;
+
+    while (index + 8 <= self.length && index - first + 8 < 20) {
+        u64 word = bits_load_u64(self.memory + index);
+
+        if (parse_is_eight_digits(word) == false) break;
+
+        value  = value * 100000000 + parse_eight_digits(word);
+        index += 8;
+    }
+
+    while (index < self.length) {
+        u8 digit = self.memory[index] - '0';
+
+        if (digit > 9) break;
+
+        if (value > ((u64)(-1) - digit) / 10)
+            result.error = PARSE_ERROR_OVERFLOW;
+
+        value  = value * 10 + digit;
+        index += 1;
+    }
+
+    if (index == first) {
+        result.error = PARSE_ERROR_INVALID;
+
+        return result;
+    }
+
+    if (result.error == PARSE_ERROR_OVERFLOW)
+        value = (u64)(-1);
+
+    result.value = value;
+    result.units = index - start;
+
+    return result;
+}
+
+Parse_I64 str8_parse_i64(String_8 self, isize index)
+{
+    Parse_I64 result = {};
+
+    isize start = index;
+    bool  minus = false;
+
+    if (index < 0 || index > self.length) {
+        result.error = PARSE_ERROR_OUT_OF_BOUNDS;
+
+        return result;
+    }
+
+    if (index < self.length && (self.memory[index] == '-' || self.memory[index] == '+')) {
+        minus  = self.memory[index] == '-';
+        index += 1;
+    }
+
+    Parse_U64 parse = str8_parse_u64(self, index);
+
+    if (index > start && index < self.length && self.memory[index] == '+')
+        parse.error = PARSE_ERROR_INVALID;
+
+    if (parse.error == PARSE_ERROR_INVALID) {
+        result.error = PARSE_ERROR_INVALID;
+
+        return result;
+    }
+
+    u64 limit = (u64)(1) << 63;
+
+    if (minus == false) limit -= 1;
+
+    result.error = parse.error;
+
+    if (parse.value > limit) {
+        result.error = PARSE_ERROR_OVERFLOW;
+        parse.value  = limit;
+    }
+
+    if (minus == true)
+        result.value = (i64)(0 - parse.value);
+    else
+        result.value = (i64)(parse.value);
+
+    result.units = index + parse.units - start;
+
+    return result;
+}
+
+Parse_F64 str8_parse_f64(String_8 self, isize index)
+{
+    Parse_F64 result = {};
+
+    isize start = index;
+    bool  minus = false;
+
+    if (index < 0 || index > self.length) {
+        result.error = PARSE_ERROR_OUT_OF_BOUNDS;
+
+        return result;
+    }
+
+    if (index < self.length && (self.memory[index] == '-' || self.memory[index] == '+')) {
+        minus  = self.memory[index] == '-';
+        index += 1;
+    }
+
+    u64 sign = (u64)(minus) << 63;
+
+    if (parse_is_word(self, index, PAX_STR_8("inf")) == true) {
+        index += 3;
+
+        if (parse_is_word(self, index, PAX_STR_8("inity")) == true)
+            index += 5;
+
+        result.value = bits_to_f64(sign | ((u64)(0x7ff) << 52));
+        result.units = index - start;
+
+        return result;
+    }
+
+    if (parse_is_word(self, index, PAX_STR_8("nan")) == true) {
+        result.value = bits_to_f64(sign | ((u64)(0xfff) << 51));
+        result.units = index + 3 - start;
+
+        return result;
+    }
+
+    isize begin     = index;
+    isize count     = 0;
+    isize digits    = 0;
+    isize exponent  = 0;
+    u64   mantissa  = 0;
+    bool  truncated = false;
+    bool  fraction  = false;
+
+    while (index < self.length) {
+        u8 value = self.memory[index];
+
+        if (value == '.' && fraction == false) {
+            fraction = true;
+            index   += 1;
+
+            continue;
+        }
+
+        if (value == '0' && digits == 0) {
+            if (fraction == true) exponent -= 1;
+
+            count += 1;
+            index += 1;
+
+            continue;
+        }
+
+        if (digits + 8 <= 19 && index + 8 <= self.length) {
+            u64 word = bits_load_u64(self.memory + index);
+
+            if (parse_is_eight_digits(word) == true) {
+                mantissa = mantissa * 100000000 + parse_eight_digits(word);
+
+                if (fraction == true) exponent -= 8;
+
+                digits += 8;
+                count  += 8;
+                index  += 8;
+
+                continue;
+            }
+        }
+
+        u8 digit = value - '0';
+
+        if (digit > 9) break;
+
+        if (digits < 19) {
+            mantissa = mantissa * 10 + digit;
+            digits  += 1;
+
+            if (fraction == true) exponent -= 1;
+        } else {
+            if (digit != 0) truncated = true;
+
+            if (fraction == false) exponent += 1;
+        }
+
+        count += 1;
+        index += 1;
+    }
+
+    if (count == 0) {
+        result.error = PARSE_ERROR_INVALID;
+
+        return result;
+    }
+
+    isize stop  = index;
+    isize power = 0;
+
+    if (index < self.length && (self.memory[index] | 0x20) == 'e') {
+        isize other = index + 1;
+        bool  below = false;
+
+        if (other < self.length && (self.memory[other] == '-' || self.memory[other] == '+')) {
+            below  = self.memory[other] == '-';
+            other += 1;
+        }
+
+        if (other < self.length && (u8)(self.memory[other] - '0') <= 9) {
+            while (other < self.length) {
+                u8 digit = self.memory[other] - '0';
+
+                if (digit > 9) break;
+
+                if (power < 100000)
+                    power = power * 10 + digit;
+
+                other += 1;
+            }
+
+            if (below == true) power = -power;
+
+            index = other;
+        }
+    }
+
+    result.units = index - start;
+
+    exponent += power;
+
+    if (truncated == false) {
+        if (mantissa == 0) {
+            result.value = bits_to_f64(sign);
+
+            return result;
+        }
+
+        if (mantissa <= ((u64)(1) << 53) && exponent >= -22 && exponent <= 22 + 15) {
+            bool  exact  = true;
+            f64   value  = (f64)(mantissa);
+            isize places = exponent;
+
+            if (places > 22) {
+                u64 scale = PARSE_POW_10_U64[places - 22];
+
+                exact  = mantissa <= ((u64)(1) << 53) / scale;
+                value  = (f64)(mantissa * scale);
+                places = 22;
+            }
+
+            if (exact == true) {
+                if (places < 0)
+                    value = value / PARSE_POW_10[-places];
+                else
+                    value = value * PARSE_POW_10[places];
+
+                result.value = minus == true ? -value : value;
+
+                return result;
+            }
+        }
+    }
+
+    u64 bits  = 0;
+    u64 other = 0;
+
+    if (parse_eisel_lemire(mantissa, exponent, &bits) == true) {
+        bool exact = truncated == false;
+
+        if (exact == false && parse_eisel_lemire(mantissa + 1, exponent, &other) == true)
+            exact = other == bits;
+
+        if (exact == true) {
+            result.value = bits_to_f64(sign | bits);
+
+            return result;
+        }
+    }
+
+    Decimal decimal = {};
+
+    bool point = false;
+
+    for (isize i = begin; i < stop; i += 1) {
+        u8 value = self.memory[i];
+
+        if (value == '.') {
+            point = true;
+
+            continue;
+        }
+
+        u8 digit = value - '0';
+
+        if (digit == 0 && decimal.count == 0) {
+            if (point == true) decimal.point -= 1;
+
+            continue;
+        }
+
+        if (point == false) decimal.point += 1;
+
+        if (decimal.count < DECIMAL_DIGITS) {
+            decimal.digits[decimal.count] = digit;
+            decimal.count += 1;
+        } else if (digit != 0)
+            decimal.truncated = true;
+    }
+
+    decimal.point += power;
+
+    decimal_trim(&decimal);
+
+    bool overflow = false;
+
+    bits = decimal_to_f64_bits(&decimal, &overflow);
+
+    if (overflow == true)
+        result.error = PARSE_ERROR_OVERFLOW;
+
+    result.value = bits_to_f64(sign | bits);
+
+    return result;
+}
+
+static const u64 FORMAT_POW_10[20] = {
+    1,
+    10,
+    100,
+    1000,
+    10000,
+    100000,
+    1000000,
+    10000000,
+    100000000,
+    1000000000,
+    10000000000,
+    100000000000,
+    1000000000000,
+    10000000000000,
+    100000000000000,
+    1000000000000000,
+    10000000000000000,
+    100000000000000000,
+    1000000000000000000,
+    10000000000000000000u,
+};
+
+static const u8 FORMAT_DIGITS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const u8 FORMAT_HEX[17] = "0123456789abcdef";
+
+static isize format_count_digits(u64 value)
+{
+    isize bits  = 64 - bits_count_leading(value | 1);
+    isize guess = (bits * 1233) >> 12;
+
+    if ((value | 1) < FORMAT_POW_10[guess])
+        return guess;
+
+    return guess + 1;
+}
+
+static void format_write_u64(u8* memory, u64 value, isize count)
+{
+    isize index = count;
+
+    while (value >= 100) {
+        isize pair = (isize)(value % 100) * 2;
+
+        value /= 100;
+        index -= 2;
+
+        memory[index + 0] = FORMAT_DIGITS[pair + 0];
+        memory[index + 1] = FORMAT_DIGITS[pair + 1];
+    }
+
+    if (value >= 10) {
+        isize pair = (isize)(value) * 2;
+
+        memory[index - 2] = FORMAT_DIGITS[pair + 0];
+        memory[index - 1] = FORMAT_DIGITS[pair + 1];
+    } else
+        memory[index - 1] = (u8)('0' + value);
+}
+
+static u64 format_round_to_odd(u64 high, u64 low, u64 value)
+{
+    u64 upper = 0;
+    u64 carry = 0;
+
+    bits_mul_u128(low, value, &carry);
+
+    u64 lower = bits_mul_u128(high, value, &upper);
+    u64 sum   = lower + carry;
+
+    if (sum < lower) upper += 1;
+
+    return upper | (sum > 1 ? 1 : 0);
+}
+
+static void format_shortest(u64 mantissa, isize exponent, u64* digits, isize* power)
+{
+    u64   value = mantissa;
+    isize scale = 1 - 1075;
+
+    if (exponent != 0) {
+        value = mantissa | ((u64)(1) << 52);
+        scale = exponent - 1075;
+
+        if (scale <= 0 && scale > -53 && (value & (((u64)(1) << -scale) - 1)) == 0) {
+            *digits = value >> -scale;
+            *power  = 0;
+
+            return;
+        }
+    }
+
+    bool even   = (value & 1) == 0;
+    bool closer = mantissa == 0 && exponent > 1;
+
+    isize place = (scale * 1262611 - (closer == true ? 524031 : 0)) >> 22;
+    isize shift = scale + ((-place * 1741647) >> 19) + 1;
+
+    const u64* table = PARSE_POW_10_WIDE[-place - PARSE_POW_10_MIN];
+
+    u64 high = table[1];
+    u64 low  = table[0];
+
+    if (-place < 0 || -place > 55) {
+        low += 1;
+
+        if (low == 0) high += 1;
+    }
+
+    u64 below  = format_round_to_odd(high, low, (4 * value - 2 + (closer == true ? 1 : 0)) << shift);
+    u64 center = format_round_to_odd(high, low, (4 * value) << shift);
+    u64 above  = format_round_to_odd(high, low, (4 * value + 2) << shift);
+
+    if (even == false) {
+        below += 1;
+        above -= 1;
+    }
+
+    u64 result = center / 4;
+
+    if (result >= 10) {
+        u64 other = result / 10;
+
+        bool lower = below <= 40 * other;
+        bool upper = 40 * other + 40 <= above;
+
+        if (lower != upper) {
+            *digits = other + (upper == true ? 1 : 0);
+            *power  = place + 1;
+
+            return;
+        }
+    }
+
+    bool lower = below <= 4 * result;
+    bool upper = 4 * result + 4 <= above;
+
+    if (lower == upper) {
+        u64 middle = 4 * result + 2;
+
+        upper = center > middle || (center == middle && (result & 1) != 0);
+    }
+
+    *digits = result + (upper == true ? 1 : 0);
+    *power  = place;
+}
+
+static bool str8_builder_grow(Str8_Builder* self, isize capacity PAX_SITE_DEFINE)
+{
+    Mem_Block block = {self->memory, self->capacity};
+
+    block = arena_resize(self->arena, block, capacity, 1 PAX_SITE_FORWARD);
+
+    if (block.memory == 0) return false;
+
+    self->memory   = block.memory;
+    self->capacity = capacity;
+
+    return true;
+}
+
+static bool str8_builder_reserve(Str8_Builder* self, isize bytes PAX_SITE_DEFINE)
+{
+    if (bytes <= self->capacity - self->length) return true;
+
+    if (bytes > PAX_ISIZE_MAX - self->length) return false;
+
+    isize length   = self->length + bytes;
+    isize capacity = PAX_ISIZE_MAX;
+
+    if (self->capacity <= PAX_ISIZE_MAX / 2)
+        capacity = PAX_MAX(self->capacity * 2, 64);
+
+    if (capacity > length && str8_builder_grow(self, capacity PAX_SITE_FORWARD) == true)
+        return true;
+
+    return str8_builder_grow(self, length PAX_SITE_FORWARD);
+}
+
+void str8_builder_init(Str8_Builder* self, Mem_Arena* arena)
+{
+    Str8_Builder result = {};
+
+    result.arena = arena;
+
+    *self = result;
+}
+
+bool str8_builder_push_str8(Str8_Builder* self, String_8 value PAX_SITE_DEFINE)
+{
+    if (value.length <= 0) return true;
+
+    if (str8_builder_reserve(self, value.length PAX_SITE_FORWARD) == false)
+        return false;
+
+    u8* memory = self->memory + self->length;
+
+    for (isize i = 0; i < value.length; i += 1)
+        memory[i] = value.memory[i];
+
+    self->length += value.length;
+
+    return true;
+}
+
+bool str8_builder_push_u64(Str8_Builder* self, u64 value PAX_SITE_DEFINE)
+{
+    isize count = format_count_digits(value);
+
+    if (str8_builder_reserve(self, count PAX_SITE_FORWARD) == false)
+        return false;
+
+    format_write_u64(self->memory + self->length, value, count);
+
+    self->length += count;
+
+    return true;
+}
+
+bool str8_builder_push_i64(Str8_Builder* self, i64 value PAX_SITE_DEFINE)
+{
+    u64   magnitude = (u64)(value);
+    isize sign      = 0;
+
+    if (value < 0) {
+        magnitude = 0 - magnitude;
+        sign      = 1;
+    }
+
+    isize count = format_count_digits(magnitude);
+
+    if (str8_builder_reserve(self, sign + count PAX_SITE_FORWARD) == false)
+        return false;
+
+    u8* memory = self->memory + self->length;
+
+    if (sign != 0) memory[0] = '-';
+
+    format_write_u64(memory + sign, magnitude, count);
+
+    self->length += sign + count;
+
+    return true;
+}
+
+bool str8_builder_push_hex(Str8_Builder* self, u64 value, isize digits PAX_SITE_DEFINE)
+{
+    isize count = (64 - bits_count_leading(value | 1) + 3) / 4;
+
+    count = PAX_MAX(count, digits);
+
+    if (str8_builder_reserve(self, count PAX_SITE_FORWARD) == false)
+        return false;
+
+    u8* memory = self->memory + self->length;
+
+    for (isize i = count; i > 0; i -= 1) {
+        memory[i - 1] = FORMAT_HEX[value & 0xf];
+
+        value >>= 4;
+    }
+
+    self->length += count;
+
+    return true;
+}
+
+bool str8_builder_push_f64(Str8_Builder* self, f64 value PAX_SITE_DEFINE)
+{
+    u64   bits     = bits_from_f64(value);
+    u64   mantissa = bits & (((u64)(1) << 52) - 1);
+    isize exponent = (isize)((bits >> 52) & 0x7ff);
+
+    if (exponent == 0x7ff && mantissa != 0)
+        return str8_builder_push_str8(self, PAX_STR_8("nan") PAX_SITE_FORWARD);
+
+    if (str8_builder_reserve(self, 32 PAX_SITE_FORWARD) == false)
+        return false;
+
+    u8*   memory = self->memory + self->length;
+    isize index  = 0;
+
+    if ((bits >> 63) != 0) {
+        memory[index] = '-';
+        index += 1;
+    }
+
+    if (exponent == 0x7ff) {
+        memory[index + 0] = 'i';
+        memory[index + 1] = 'n';
+        memory[index + 2] = 'f';
+
+        self->length += index + 3;
+
+        return true;
+    }
+
+    if (exponent == 0 && mantissa == 0) {
+        memory[index] = '0';
+
+        self->length += index + 1;
+
+        return true;
+    }
+
+    u64   digits = 0;
+    isize power  = 0;
+
+    format_shortest(mantissa, exponent, &digits, &power);
+
+    while (digits % 10 == 0) {
+        digits /= 10;
+        power  += 1;
+    }
+
+    u8 buffer[20] = {};
+
+    isize count = format_count_digits(digits);
+    isize point = count + power;
+
+    format_write_u64(buffer, digits, count);
+
+    if (power >= 0 && point <= 21) {
+        for (isize i = 0; i < count; i += 1)
+            memory[index + i] = buffer[i];
+
+        index += count;
+
+        for (isize i = 0; i < power; i += 1)
+            memory[index + i] = '0';
+
+        index += power;
+    } else if (point > 0 && point <= 21) {
+        for (isize i = 0; i < point; i += 1)
+            memory[index + i] = buffer[i];
+
+        memory[index + point] = '.';
+
+        for (isize i = point; i < count; i += 1)
+            memory[index + i + 1] = buffer[i];
+
+        index += count + 1;
+    } else if (point > -6 && point <= 0) {
+        memory[index + 0] = '0';
+        memory[index + 1] = '.';
+
+        index += 2;
+
+        for (isize i = 0; i < -point; i += 1)
+            memory[index + i] = '0';
+
+        index -= point;
+
+        for (isize i = 0; i < count; i += 1)
+            memory[index + i] = buffer[i];
+
+        index += count;
+    } else {
+        memory[index] = buffer[0];
+
+        index += 1;
+
+        if (count > 1) {
+            memory[index] = '.';
+
+            for (isize i = 1; i < count; i += 1)
+                memory[index + i] = buffer[i];
+
+            index += count;
+        }
+
+        isize scale = point - 1;
+
+        memory[index + 0] = 'e';
+        memory[index + 1] = '+';
+
+        if (scale < 0) {
+            memory[index + 1] = '-';
+            scale = -scale;
+        }
+
+        index += 2;
+
+        isize places = format_count_digits((u64)(scale));
+
+        format_write_u64(memory + index, (u64)(scale), places);
+
+        index += places;
+    }
+
+    self->length += index;
+
+    return true;
+}
+
+String_8 str8_builder_finish(Str8_Builder* self)
+{
+    String_8   result = {};
+    Mem_Arena* arena  = self->arena;
+
+    if (self->memory == 0) return result;
+
+    if (self->memory + self->capacity == arena->memory + arena->offset) {
+        arena->offset -= self->capacity - self->length;
+
+        self->capacity = self->length;
+    }
+
+    result.memory = self->memory;
+    result.length = self->length;
+
+    return result;
+}
+
+static const isize ARENA_CHUNK_ALIGN = 64;
+
+isize align_by(isize value, isize align)
+{
+    isize error = value % align;
+    isize extra = 0;
+
+    if (error != 0)
+        extra = align - error;
+
+    return value + extra;
+}
+
+void arena_init(Mem_Arena* self, Mem_Block block)
+{
+    Mem_Arena result = {};
+
+    if (block.memory != 0) {
+        result.memory    = block.memory;
+        result.length    = block.length;
+        result.committed = block.length;
+    }
+
+    *self = result;
+}
+
+void arena_init_lazy(Mem_Arena* self, Mem_Block block, isize step, Mem_Commit commit)
+{
+    Mem_Arena result = {};
+
+    if (block.memory != 0) {
+        result.memory = block.memory;
+        result.length = block.length;
+    }
+
+    result.step   = PAX_MAX(step, 1);
+    result.commit = commit;
+
+    *self = result;
+}
+
+void arena_init_chain(Mem_Arena* self, isize size, isize growth, Mem_Reserve reserve, Mem_Release release)
+{
+    Mem_Arena result = {};
+
+    result.size    = PAX_MAX(size, 1);
+    result.growth  = PAX_MAX(growth, 1);
+    result.reserve = reserve;
+    result.release = release;
+
+    *self = result;
+}
+
+static isize arena_padding(Mem_Arena* self, isize align)
+{
+    u64 address = (u64)(self->memory) + (u64)(self->offset);
+
+    return (isize)(((u64)(align) - address % (u64)(align)) % (u64)(align));
+}
+
+static void arena_load(Mem_Arena* self, Mem_Chunk* chunk)
+{
+    isize header = align_by(PAX_SIZE_OF(Mem_Chunk), ARENA_CHUNK_ALIGN);
+
+    self->chunk     = chunk;
+    self->memory    = chunk->block.memory + header - chunk->base;
+    self->length    = chunk->base + chunk->block.length - header;
+    self->committed = self->length;
+}
+
+static bool arena_grow(Mem_Arena* self, isize bytes, isize align)
+{
+    isize header = align_by(PAX_SIZE_OF(Mem_Chunk), ARENA_CHUNK_ALIGN);
+    isize base   = align_by(self->offset, ARENA_CHUNK_ALIGN);
+
+    if (bytes > PAX_ISIZE_MAX - header - align) return false;
+
+    isize length = header + bytes + align - 1;
+
+    Mem_Chunk*  chunk = 0;
+    Mem_Chunk** link  = &self->spare;
+
+    while (*link != 0) {
+        if ((*link)->block.length >= length) {
+            chunk = *link;
+            *link = chunk->prev;
+
+            break;
+        }
+
+        link = &(*link)->prev;
+    }
+
+    if (chunk == 0) {
+        Mem_Block block = self->reserve(PAX_MAX(self->size, length));
+
+        if (block.memory == 0) return false;
+
+        chunk = (Mem_Chunk*)(block.memory);
+
+        chunk->block = block;
+
+        if (block.length < length) {
+            chunk->prev = self->spare;
+            self->spare = chunk;
+
+            return false;
+        }
+
+        if (self->size <= PAX_ISIZE_MAX / self->growth)
+            self->size *= self->growth;
+    }
+
+    if (chunk->block.length - header > PAX_ISIZE_MAX - base) {
+        chunk->prev = self->spare;
+        self->spare = chunk;
+
+        return false;
+    }
+
+    chunk->prev = self->chunk;
+    chunk->base = base;
+
+    arena_load(self, chunk);
+
+    self->offset = base;
+
+    return true;
+}
+
+void arena_release(Mem_Arena* self)
+{
+    Mem_Chunk* lists[2] = {self->chunk, self->spare};
+
+    if (self->reserve == 0) return;
+
+    for (isize i = 0; i < 2; i += 1) {
+        Mem_Chunk* chunk = lists[i];
+
+        while (chunk != 0) {
+            Mem_Chunk* prev  = chunk->prev;
+            Mem_Block  block = chunk->block;
+
+            if (self->release != 0)
+                self->release(block);
+
+            chunk = prev;
+        }
+    }
+
+    self->memory    = 0;
+    self->length    = 0;
+    self->offset    = 0;
+    self->committed = 0;
+    self->chunk     = 0;
+    self->spare     = 0;
+}
+
+static bool arena_commit(Mem_Arena* self, isize length)
+{
+    isize stop = self->length;
+
+    if (self->commit == 0) return false;
+
+    if (length <= self->length - self->step)
+        stop = align_by(length, self->step);
+
+    Mem_Block block = {
+        self->memory + self->committed,
+        stop - self->committed,
+    };
+
+    if (self->commit(block) == false) return false;
+
+    self->committed = stop;
+
+    return true;
+}
+
+void arena_clear(Mem_Arena* self)
+{
+    arena_pop(self, 0);
+}
+
+static void arena_zero(u8* memory, isize bytes)
+{
+    isize index = 0;
+
+#if PAX_SIMD != PAX_SIMD_NONE
+
+    Simd_U8 zero = simd_splat(0);
+
+    for (; index + SIMD_WIDTH * 4 <= bytes; index += SIMD_WIDTH * 4) {
+        simd_store(memory + index + SIMD_WIDTH * 0, zero);
+        simd_store(memory + index + SIMD_WIDTH * 1, zero);
+        simd_store(memory + index + SIMD_WIDTH * 2, zero);
+        simd_store(memory + index + SIMD_WIDTH * 3, zero);
+    }
+
+    for (; index + SIMD_WIDTH <= bytes; index += SIMD_WIDTH)
+        simd_store(memory + index, zero);
+
+    if (index < bytes && bytes >= SIMD_WIDTH) {
+        simd_store(memory + bytes - SIMD_WIDTH, zero);
+
+        return;
+    }
+
+#else
+
+    isize head = PAX_MIN((isize)((0 - (u64)(memory)) & 7), bytes);
+
+    for (; index < head; index += 1)
+        memory[index] = 0;
+
+    for (; index + 8 <= bytes; index += 8)
+        *(u64*)(memory + index) = 0;
+
+#endif
+
+    for (; index < bytes; index += 1)
+        memory[index] = 0;
+}
+
+#if PAX_ARENA_STATS
+
+void arena_stats_record(Mem_Stats* self, const char* file, isize line, isize bytes, isize waste, isize peak)
+{
+    isize capacity = PAX_ARRAY_ITEMS(self->sites);
+    u64   hash     = hash_finish((u64)(file) ^ ((u64)(line) * HASH_PRIME_1));
+
+    self->pushes += 1;
+    self->bytes  += (u64)(bytes);
+    self->waste  += (u64)(waste);
+    self->peak    = PAX_MAX(self->peak, peak);
+
+    for (isize i = 0; i < capacity; i += 1) {
+        Mem_Site* site = &self->sites[(hash + i) & (capacity - 1)];
+
+        if (site->file == 0) {
+            site->file = file;
+            site->line = line;
+
+            self->count += 1;
+        }
+
+        if (site->file == file && site->line == line) {
+            site->pushes += 1;
+            site->bytes  += (u64)(bytes);
+            site->waste  += (u64)(waste);
+
+            return;
+        }
+    }
+
+    self->dropped += 1;
+}
+
+void arena_stats_attach(Mem_Arena* self, Mem_Stats* stats)
+{
+    self->stats = stats;
+
+    if (stats != 0)
+        stats->peak = PAX_MAX(stats->peak, self->offset);
+}
+
+bool arena_stats_dump(Mem_Stats* self, Str8_Builder* builder)
+{
+    bool  shown[PAX_ARRAY_ITEMS(self->sites)] = {};
+    bool  result   = true;
+    isize capacity = PAX_ARRAY_ITEMS(self->sites);
+
+    result &= str8_builder_push_str8(builder, PAX_STR_8("arena: peak "));
+    result &= str8_builder_push_i64(builder, self->peak);
+    result &= str8_builder_push_str8(builder, PAX_STR_8(", pushes "));
+    result &= str8_builder_push_u64(builder, self->pushes);
+    result &= str8_builder_push_str8(builder, PAX_STR_8(", pops "));
+    result &= str8_builder_push_u64(builder, self->pops);
+    result &= str8_builder_push_str8(builder, PAX_STR_8(", bytes "));
+    result &= str8_builder_push_u64(builder, self->bytes);
+    result &= str8_builder_push_str8(builder, PAX_STR_8(", waste "));
+    result &= str8_builder_push_u64(builder, self->waste);
+    result &= str8_builder_push_str8(builder, PAX_STR_8(", dropped "));
+    result &= str8_builder_push_u64(builder, self->dropped);
+    result &= str8_builder_push_str8(builder, PAX_STR_8("\n"));
+
+    for (isize i = 0; i < self->count; i += 1) {
+        isize best = -1;
+
+        for (isize j = 0; j < capacity; j += 1) {
+            if (self->sites[j].file == 0 || shown[j] == true) continue;
+
+            if (best < 0 || self->sites[j].bytes > self->sites[best].bytes)
+                best = j;
+        }
+
+        if (best < 0) break;
+
+        Mem_Site* site = &self->sites[best];
+        String_8  file = {};
+
+        shown[best] = true;
+
+        str8_init(&file, (u8*)(site->file), 4096);
+
+        result &= str8_builder_push_str8(builder, PAX_STR_8("    "));
+        result &= str8_builder_push_str8(builder, file);
+        result &= str8_builder_push_str8(builder, PAX_STR_8(":"));
+        result &= str8_builder_push_i64(builder, site->line);
+        result &= str8_builder_push_str8(builder, PAX_STR_8(": bytes "));
+        result &= str8_builder_push_u64(builder, site->bytes);
+        result &= str8_builder_push_str8(builder, PAX_STR_8(", pushes "));
+        result &= str8_builder_push_u64(builder, site->pushes);
+        result &= str8_builder_push_str8(builder, PAX_STR_8(", waste "));
+        result &= str8_builder_push_u64(builder, site->waste);
+        result &= str8_builder_push_str8(builder, PAX_STR_8("\n"));
+    }
+
+    return result;
+}
+
+#endif
+
+Mem_Block arena_push_uninit(Mem_Arena* self, isize bytes, isize align PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+
+    if (bytes <= 0 || align <= 0) return result;
+
+    isize extra = arena_padding(self, align);
+
+    if (extra > self->length - self->offset || bytes > self->length - self->offset - extra) {
+        if (self->reserve == 0 || arena_grow(self, bytes, align) == false)
+            return result;
+
+        extra = arena_padding(self, align);
+    }
+
+    isize offset = self->offset + extra;
+
+    if (offset + bytes > self->committed && arena_commit(self, offset + bytes) == false)
+        return result;
+
+#if PAX_ARENA_STATS
+
+    if (self->stats != 0) {
+        arena_stats_record(self->stats, file, line,
+            bytes, offset - self->offset, offset + bytes);
+    }
+
+#endif
+
+    result.memory = self->memory + offset;
+    result.length = bytes;
+
+    self->offset = offset + bytes;
+
+    return result;
+}
+
+Mem_Block arena_push_array_uninit(Mem_Arena* self, isize items, isize stride, isize align PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+
+    if (stride > 0 && items > PAX_ISIZE_MAX / stride)
+        return result;
+
+    return arena_push_uninit(self, items * stride, align PAX_SITE_FORWARD);
+}
+
+Mem_Block arena_push(Mem_Arena* self, isize bytes, isize align PAX_SITE_DEFINE)
+{
+    Mem_Block result = arena_push_uninit(self, bytes, align PAX_SITE_FORWARD);
+
+    if (result.memory != 0)
+        arena_zero(result.memory, result.length);
+
+    return result;
+}
+
+Mem_Block arena_push_array(Mem_Arena* self, isize items, isize stride, isize align PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+
+    if (stride > 0 && items > PAX_ISIZE_MAX / stride)
+        return result;
+
+    return arena_push(self, items * stride, align PAX_SITE_FORWARD);
+}
+
+Mem_Block arena_resize(Mem_Arena* self, Mem_Block block, isize bytes, isize align PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+
+    if (block.memory == 0 || block.length <= 0)
+        return arena_push_uninit(self, bytes, align PAX_SITE_FORWARD);
+
+    if (bytes <= 0 || align <= 0) return result;
+
+    isize base  = 0;
+    isize start = self->offset - block.length;
+
+    if (self->chunk != 0) base = self->chunk->base;
+
+    bool top = start >= base && block.memory == self->memory + start;
+
+    if (top == true && bytes <= self->length - start) {
+        if (start + bytes > self->committed && arena_commit(self, start + bytes) == false)
+            return result;
+
+#if PAX_ARENA_STATS
+
+        if (self->stats != 0 && bytes > block.length) {
+            arena_stats_record(self->stats, file, line,
+                bytes - block.length, 0, start + bytes);
+        }
+
+#endif
+
+        self->offset = start + bytes;
+
+        result.memory = block.memory;
+        result.length = bytes;
+
+        return result;
+    }
+
+    if (bytes <= block.length) {
+        result.memory = block.memory;
+        result.length = bytes;
+
+        return result;
+    }
+
+    result = arena_push_uninit(self, bytes, align PAX_SITE_FORWARD);
+
+    if (result.memory == 0) return result;
+
+    for (isize i = 0; i < block.length; i += 1)
+        result.memory[i] = block.memory[i];
+
+    return result;
+}
+
+bool arena_pop(Mem_Arena* self, isize marker)
+{
+    if (marker < 0 || marker > self->offset)
+        return false;
+
+#if PAX_ARENA_STATS
+
+    if (self->stats != 0)
+        self->stats->pops += 1;
+
+#endif
+
+    while (self->chunk != 0 && marker < self->chunk->base) {
+        Mem_Chunk* chunk = self->chunk;
+
+        arena_load(self, chunk->prev);
+
+        chunk->prev = self->spare;
+        self->spare = chunk;
+    }
+
+    self->offset = marker;
+
+    return true;
+}
+
+Mem_Temp arena_temp_begin(Mem_Arena* arena)
+{
+    Mem_Temp result = {};
+
+    result.arena  = arena;
+    result.marker = arena->offset;
+
+    return result;
+}
+
+void arena_temp_end(Mem_Temp temp)
+{
+    if (temp.arena != 0)
+        arena_pop(temp.arena, temp.marker);
+}
+
+Mem_Scope::Mem_Scope(Mem_Temp value)
+    : temp(value)
+{}
+
+Mem_Scope::~Mem_Scope()
+{
+    arena_temp_end(temp);
+}
+
+static const isize POOL_SLOTS_MIN = 16;
+static const isize POOL_SLOTS_MAX = 1024;
+
+static bool pool_next(Mem_Pool* self PAX_SITE_DEFINE)
+{
+    Mem_Slab* slab = self->slabs;
+
+    if (self->slab != 0) slab = self->slab->next;
+
+    if (slab == 0) {
+        isize     header = align_by(PAX_SIZE_OF(Mem_Slab), self->align);
+        isize     slots  = self->slots;
+        Mem_Block block  = {};
+
+        while (block.memory == 0 && slots > 0) {
+            if (slots <= (PAX_ISIZE_MAX - header) / self->stride) {
+                block = arena_push_uninit(self->arena, header + slots * self->stride,
+                    self->align PAX_SITE_FORWARD);
+            }
+
+            if (block.memory == 0) slots /= 2;
+        }
+
+        if (block.memory == 0) return false;
+
+        slab = (Mem_Slab*)(block.memory);
+
+        slab->next         = 0;
+        slab->block.memory = block.memory + header;
+        slab->block.length = slots * self->stride;
+
+        if (self->slab != 0)
+            self->slab->next = slab;
+        else
+            self->slabs = slab;
+
+        if (self->slots <= POOL_SLOTS_MAX / 2)
+            self->slots *= 2;
+    }
+
+    self->slab   = slab;
+    self->offset = 0;
+
+    return true;
+}
+
+bool pool_init(Mem_Pool* self, Mem_Arena* arena, isize size, isize align)
+{
+    Mem_Pool result = {};
+
+    if (size <= 0 || align <= 0) return false;
 
-    isize marker = arena->offset;
-    isize units  = str32_count_as_utf16(self);
+    align = PAX_MAX(align, (isize)(PAX_ALIGN_OF(Mem_Slab)));
+    size  = PAX_MAX(size, (isize)(PAX_SIZE_OF(Mem_Slot)));
 
-    Mem_Block block = arena_push_array(arena, units + 1,
-        PAX_SIZE_OF(u16), PAX_ALIGN_OF(u16));
+    if (size > PAX_ISIZE_MAX - align) return false;
 
-    if (block.memory == 0) return false;
+    result.arena  = arena;
+    result.size   = size;
+    result.stride = align_by(size, align);
+    result.align  = align;
+    result.slots  = POOL_SLOTS_MIN;
 
-    result.memory = (u16*)(block.memory);
-    result.length = units;
+    *self = result;
 
-    isize index = 0;
-    isize other = 0;
+    return true;
+}
 
-    while (index < self.length) {
-        UTF_Result decode = str32_decode(self, index);
+Mem_Block pool_push_uninit(Mem_Pool* self PAX_SITE_DEFINE)
+{
+    Mem_Block result = {};
+    Mem_Slot* slot   = self->free;
 
-        if (decode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+    if (slot != 0) {
+        self->free = slot->next;
 
-            return false;
+        result.memory = PAX_U8_PTR(slot);
+        result.length = self->size;
+    } else {
+        if (self->slab == 0 || self->offset == self->slab->block.length) {
+            if (pool_next(self PAX_SITE_FORWARD) == false) return result;
         }
 
-        UTF_Result encode = str16_encode(result, other,
-            decode.value);
+        result.memory = self->slab->block.memory + self->offset;
+        result.length = self->size;
 
-        if (encode.error != UTF_ERROR_NONE) {
-            arena_pop(arena, marker);
+        self->offset += self->stride;
+    }
 
-            return false;
+    self->count += 1;
+
+    return result;
+}
+
+Mem_Block pool_push(Mem_Pool* self PAX_SITE_DEFINE)
+{
+    Mem_Block result = pool_push_uninit(self PAX_SITE_FORWARD);
+
+    if (result.memory != 0)
+        arena_zero(result.memory, result.length);
+
+    return result;
+}
+
+bool pool_pop(Mem_Pool* self, ptr memory)
+{
+    Mem_Slot* slot = (Mem_Slot*)(memory);
+
+    if (slot == 0 || self->count <= 0) return false;
+
+    slot->next = self->free;
+    self->free = slot;
+
+    self->count -= 1;
+
+    return true;
+}
+
+void pool_clear(Mem_Pool* self)
+{
+    self->free   = 0;
+    self->slab   = 0;
+    self->offset = 0;
+    self->count  = 0;
+}
+
+static const isize HEAP_FIRST_COUNT  = 32;
+static const isize HEAP_SECOND_COUNT = 16;
+static const isize HEAP_SECOND_LOG   = 4;
+static const isize HEAP_ALIGN        = 16;
+static const isize HEAP_HEADER       = 16;
+static const isize HEAP_MINIMUM      = HEAP_HEADER + HEAP_ALIGN;
+static const isize HEAP_SMALL        = HEAP_SECOND_COUNT * HEAP_ALIGN;
+static const isize HEAP_SHIFT        = 8;
+static const isize HEAP_FREE         = 1;
+
+static isize heap_size(Mem_Heap_Node* node)
+{
+    return node->size & ~HEAP_FREE;
+}
+
+Mem_Heap_Node* heap_next(Mem_Heap_Node* node)
+{
+    return (Mem_Heap_Node*)(PAX_U8_PTR(node) + HEAP_HEADER + heap_size(node));
+}
+
+static void heap_mapping(isize size, isize* first, isize* second)
+{
+    if (size < HEAP_SMALL) {
+        *first  = 0;
+        *second = size / HEAP_ALIGN;
+
+        return;
+    }
+
+    isize msb = 63 - bits_count_leading((u64)(size));
+
+    *first  = msb - HEAP_SHIFT + 1;
+    *second = (isize)(((u64)(size) >> (msb - HEAP_SECOND_LOG)) ^ HEAP_SECOND_COUNT);
+}
+
+static void heap_insert(Mem_Heap* self, Mem_Heap_Node* node)
+{
+    isize first  = 0;
+    isize second = 0;
+
+    heap_mapping(heap_size(node), &first, &second);
+
+    Mem_Heap_Node* head = self->heads[first][second];
+
+    node->size     |= HEAP_FREE;
+    node->next_free = head;
+    node->prev_free = 0;
+
+    if (head != 0) head->prev_free = node;
+
+    self->heads[first][second] = node;
+
+    self->seconds[first] |= (u32)(1) << second;
+    self->firsts         |= (u64)(1) << first;
+
+    self->free  += heap_size(node);
+    self->count += 1;
+}
+
+static void heap_remove(Mem_Heap* self, Mem_Heap_Node* node)
+{
+    isize first  = 0;
+    isize second = 0;
+
+    heap_mapping(heap_size(node), &first, &second);
+
+    if (node->next_free != 0) node->next_free->prev_free = node->prev_free;
+    if (node->prev_free != 0) node->prev_free->next_free = node->next_free;
+
+    if (self->heads[first][second] == node) {
+        self->heads[first][second] = node->next_free;
+
+        if (node->next_free == 0) {
+            self->seconds[first] &= ~((u32)(1) << second);
+
+            if (self->seconds[first] == 0)
+                self->firsts &= ~((u64)(1) << first);
         }
+    }
 
-        index += decode.units;
-        other += encode.units;
+    node->size &= ~HEAP_FREE;
+
+    self->free  -= node->size;
+    self->count -= 1;
+}
+
+Mem_Heap_Node* heap_find(Mem_Heap* self, isize size)
+{
+    isize first  = 0;
+    isize second = 0;
+
+    if (size >= HEAP_SMALL) {
+        isize msb = 63 - bits_count_leading((u64)(size));
+
+        size += ((isize)(1) << (msb - HEAP_SECOND_LOG)) - 1;
     }
 
-    *string = result;
+    heap_mapping(size, &first, &second);
+
+    if (first >= HEAP_FIRST_COUNT) return 0;
+
+    u32 seconds = self->seconds[first] & (~(u32)(0) << second);
+
+    if (seconds == 0) {
+        u64 firsts = self->firsts & (~(u64)(0) << (first + 1));
+
+        if (firsts == 0) return 0;
+
+        first   = bits_count_trailing(firsts);
+        seconds = self->seconds[first];
+    }
+
+    second = bits_count_trailing(seconds);
+
+    return self->heads[first][second];
+}
+
+bool heap_init(Mem_Heap* self, Mem_Block block)
+{
+    Mem_Heap result = {};
+
+    u64 limit = (u64)(1) << (HEAP_SHIFT + HEAP_FIRST_COUNT - 1);
+    u64 start = ((u64)(block.memory) + HEAP_ALIGN - 1) & ~(u64)(HEAP_ALIGN - 1);
+
+    if (block.memory == 0 || block.length < HEAP_ALIGN)
+        return false;
+
+    isize length = block.length - (isize)(start - (u64)(block.memory));
+
+    length &= ~(HEAP_ALIGN - 1);
+
+    if ((u64)(length) >= limit)
+        length = (isize)(limit - HEAP_ALIGN);
+
+    if (length < HEAP_MINIMUM + HEAP_HEADER) return false;
+
+    Mem_Heap_Node* node = (Mem_Heap_Node*)(start);
+    Mem_Heap_Node* last = (Mem_Heap_Node*)(start + length - HEAP_HEADER);
+
+    node->prev = 0;
+    node->size = length - 2 * HEAP_HEADER;
+    last->prev = node;
+    last->size = 0;
+
+    result.block.memory = (u8*)(start);
+    result.block.length = length;
+
+    heap_insert(&result, node);
+
+    *self = result;
 
     return true;
 }
 
-isize align_by(isize value, isize align)
+Mem_Block heap_push_uninit(Mem_Heap* self, isize bytes, isize align)
 {
-    isize error = value % align;
+    Mem_Block result = {};
+
+    if (bytes <= 0 || align <= 0) return result;
+
+    if (bytes > self->block.length - HEAP_ALIGN) return result;
+
+    isize size  = PAX_MAX(align_by(bytes, HEAP_ALIGN), HEAP_ALIGN);
+    isize step  = align;
     isize extra = 0;
 
-    if (error != 0)
-        extra = align - error;
+    if (HEAP_ALIGN % align != 0) {
+        while (step % HEAP_ALIGN != 0 && step <= self->block.length)
+            step += align;
 
-    return value + extra;
+        if (step > self->block.length - size - HEAP_MINIMUM)
+            return result;
+
+        extra = step + HEAP_MINIMUM;
+    }
+
+    Mem_Heap_Node* node = heap_find(self, size + extra);
+
+    if (node == 0) return result;
+
+    heap_remove(self, node);
+
+    if (extra != 0) {
+        u64 start  = (u64)(node) + HEAP_HEADER;
+        u64 target = start + (step - start % step) % step;
+
+        while (target != start && target - start < (u64)(HEAP_MINIMUM))
+            target += step;
+
+        if (target != start) {
+            isize          gap  = (isize)(target - start);
+            Mem_Heap_Node* next = (Mem_Heap_Node*)(target - HEAP_HEADER);
+
+            next->prev = node;
+            next->size = node->size - gap;
+
+            heap_next(next)->prev = next;
+
+            node->size = gap - HEAP_HEADER;
+
+            heap_insert(self, node);
+
+            node = next;
+        }
+    }
+
+    if (node->size - size >= HEAP_MINIMUM) {
+        Mem_Heap_Node* tail = (Mem_Heap_Node*)(PAX_U8_PTR(node) + HEAP_HEADER + size);
+
+        tail->prev = node;
+        tail->size = node->size - size - HEAP_HEADER;
+
+        heap_next(tail)->prev = tail;
+
+        node->size = size;
+
+        heap_insert(self, tail);
+    }
+
+    self->used += node->size;
+
+    result.memory = PAX_U8_PTR(node) + HEAP_HEADER;
+    result.length = bytes;
+
+    return result;
 }
 
-void arena_init(Mem_Arena* self, Mem_Block block)
+Mem_Block heap_push(Mem_Heap* self, isize bytes, isize align)
+{
+    Mem_Block result = heap_push_uninit(self, bytes, align);
+
+    if (result.memory != 0)
+        arena_zero(result.memory, result.length);
+
+    return result;
+}
+
+bool heap_pop(Mem_Heap* self, ptr memory)
+{
+    u8* start = self->block.memory + HEAP_HEADER;
+    u8* stop  = self->block.memory + self->block.length - HEAP_HEADER;
+
+    if (PAX_U8_PTR(memory) < start || PAX_U8_PTR(memory) >= stop)
+        return false;
+
+    Mem_Heap_Node* node = (Mem_Heap_Node*)(PAX_U8_PTR(memory) - HEAP_HEADER);
+    Mem_Heap_Node* prev = node->prev;
+    Mem_Heap_Node* next = heap_next(node);
+
+    if ((node->size & HEAP_FREE) != 0) return false;
+
+    self->used -= node->size;
+
+    if (prev != 0 && (prev->size & HEAP_FREE) != 0) {
+        heap_remove(self, prev);
+
+        prev->size += HEAP_HEADER + node->size;
+        next->prev  = prev;
+
+        node = prev;
+    }
+
+    if ((next->size & HEAP_FREE) != 0) {
+        heap_remove(self, next);
+
+        node->size += HEAP_HEADER + next->size;
+
+        heap_next(node)->prev = node;
+    }
+
+    heap_insert(self, node);
+
+    return true;
+}
+
+Mem_Heap_Stats heap_stats(Mem_Heap* self)
+{
+    Mem_Heap_Stats result = {};
+
+    result.used  = self->used;
+    result.free  = self->free;
+    result.count = self->count;
+
+    if (self->firsts != 0) {
+        isize first  = 63 - bits_count_leading(self->firsts);
+        isize second = 63 - bits_count_leading(self->seconds[first]);
+
+        Mem_Heap_Node* node = self->heads[first][second];
+
+        while (node != 0) {
+            result.largest = PAX_MAX(result.largest, heap_size(node));
+
+            node = node->next_free;
+        }
+    }
+
+    if (result.free > 0)
+        result.fragmentation = 1.0 - (f64)(result.largest) / (f64)(result.free);
+
+    return result;
+}
+
+static isize shared_load(isize* value)
+{
+#if PAX_COMP == PAX_COMP_MSVC
+
+    return *(volatile isize*)(value);
+
+#else
+
+    return __atomic_load_n(value, __ATOMIC_RELAXED);
+
+#endif
+}
+
+static bool shared_compare(isize* value, isize* expected, isize desired)
+{
+#if PAX_COMP == PAX_COMP_MSVC
+
+#if PAX_ARCH == PAX_ARCH_64
+
+    isize other = (isize)(_InterlockedCompareExchange64((volatile long long*)(value),
+        (long long)(desired), (long long)(*expected)));
+
+#else
+
+    isize other = (isize)(_InterlockedCompareExchange((volatile long*)(value),
+        (long)(desired), (long)(*expected)));
+
+#endif
+
+    if (other == *expected) return true;
+
+    *expected = other;
+
+    return false;
+
+#else
+
+    return __atomic_compare_exchange_n(value, expected, desired,
+        false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+
+#endif
+}
+
+void shared_arena_init(Mem_Shared_Arena* self, Mem_Block block, isize chunk)
 {
     if (block.memory == 0)
         block.length = 0;
 
     self->memory = block.memory;
     self->length = block.length;
-}
-
-void arena_clear(Mem_Arena* self)
-{
+    self->chunk  = PAX_MAX(chunk, 0);
+    self->epoch  = 0;
     self->offset = 0;
 }
 
-Mem_Block arena_push(Mem_Arena* self, isize bytes, isize align)
+Mem_Block shared_arena_push_uninit(Mem_Shared_Arena* self, isize bytes, isize align)
 {
     Mem_Block result = {};
 
-    isize offset = align_by(self->offset, align);
-    u8*   memory = self->memory + offset;
-
     if (bytes <= 0 || align <= 0) return result;
 
-    if (offset + bytes > self->length)
-        return result;
+    isize offset = shared_load(&self->offset);
+    isize start  = 0;
 
-    result.memory = memory;
+    do {
+        u64   address = (u64)(self->memory) + (u64)(offset);
+        isize extra   = (isize)(((u64)(align) - address % (u64)(align)) % (u64)(align));
+
+        if (extra > self->length - offset || bytes > self->length - offset - extra)
+            return result;
+
+        start = offset + extra;
+    } while (shared_compare(&self->offset, &offset, start + bytes) == false);
+
+    result.memory = self->memory + start;
     result.length = bytes;
 
-    self->offset = offset + bytes;
+    return result;
+}
+
+Mem_Block shared_arena_push(Mem_Shared_Arena* self, isize bytes, isize align)
+{
+    Mem_Block result = shared_arena_push_uninit(self, bytes, align);
 
-    for (isize i = 0; i < bytes; i += 1)
-        memory[i] = 0;
+    if (result.memory != 0)
+        arena_zero(result.memory, result.length);
 
     return result;
 }
 
-Mem_Block arena_push_array(Mem_Arena* self, isize items, isize stride, isize align)
+isize shared_arena_marker(Mem_Shared_Arena* self)
 {
-    return arena_push(self, items * stride, align);
+    self->epoch += 1;
+
+    return self->offset;
 }
 
-bool arena_pop(Mem_Arena* self, isize marker)
+bool shared_arena_pop(Mem_Shared_Arena* self, isize marker)
 {
     if (marker < 0 || marker > self->offset)
         return false;
 
     self->offset = marker;
+    self->epoch += 1;
 
     return true;
 }
 
+void shared_arena_clear(Mem_Shared_Arena* self)
+{
+    shared_arena_pop(self, 0);
+}
+
+void shared_cache_init(Mem_Shared_Cache* self, Mem_Shared_Arena* arena)
+{
+    Mem_Shared_Cache result = {};
+
+    result.shared = arena;
+    result.epoch  = shared_load(&arena->epoch);
+
+    *self = result;
+}
+
+Mem_Block shared_cache_push_uninit(Mem_Shared_Cache* self, isize bytes, isize align)
+{
+    Mem_Block         result = {};
+    Mem_Shared_Arena* shared = self->shared;
+
+    if (bytes <= 0 || align <= 0) return result;
+
+    isize epoch = shared_load(&shared->epoch);
+
+    if (self->epoch != epoch) {
+        self->memory = 0;
+        self->length = 0;
+        self->offset = 0;
+        self->epoch  = epoch;
+    }
+
+    if (align > ARENA_CHUNK_ALIGN || bytes > shared->chunk / 2)
+        return shared_arena_push_uninit(shared, bytes, align);
+
+    isize offset = align_by(self->offset, align);
+
+    if (offset > self->length || bytes > self->length - offset) {
+        Mem_Block chunk = shared_arena_push_uninit(shared,
+            shared->chunk, ARENA_CHUNK_ALIGN);
+
+        if (chunk.memory == 0)
+            return shared_arena_push_uninit(shared, bytes, align);
+
+        self->memory = chunk.memory;
+        self->length = chunk.length;
+
+        offset = 0;
+    }
+
+    result.memory = self->memory + offset;
+    result.length = bytes;
+
+    self->offset = offset + bytes;
+
+    return result;
+}
+
+Mem_Block shared_cache_push(Mem_Shared_Cache* self, isize bytes, isize align)
+{
+    Mem_Block result = shared_cache_push_uninit(self, bytes, align);
+
+    if (result.memory != 0)
+        arena_zero(result.memory, result.length);
+
+    return result;
+}
+
 } // namespace pax
@@ -24,6 +24,8 @@
 #define PAX_CLAMP_BOTTOM(x, y) PAX_MAX((x), (y))
 #define PAX_CLAMP(x, y, z)     PAX_MAX(x, PAX_MIN(y, z))
 
+#define PAX_ISIZE_MAX ((isize)((usize)(-1) >> 1))
+
 #define PAX_U8_PTR(x) ((unsigned char*)(x))
 
 #define PAX_STR_8(x) \
@@ -32,6 +34,20 @@
 #define PAX_BLOCK(x) \
     Mem_Block {PAX_U8_PTR(x), PAX_ARRAY_LENGTH(x)}
 
+#if PAX_ARENA_STATS
+
+    #define PAX_SITE_PARAMS  , const char* file = __builtin_FILE(), isize line = __builtin_LINE()
+    #define PAX_SITE_DEFINE  , const char* file, isize line
+    #define PAX_SITE_FORWARD , file, line
+
+#else
+
+    #define PAX_SITE_PARAMS
+    #define PAX_SITE_DEFINE
+    #define PAX_SITE_FORWARD
+
+#endif
+
 namespace pax {
 
 //
@@ -53,6 +69,42 @@ typedef struct {
     isize     units;
 } UTF_Result;
 
+typedef struct {
+    UTF_Error error;
+    isize     offset;
+} UTF_Check;
+
+typedef struct {
+    UTF_Error error;
+    isize     consumed;
+    isize     produced;
+} UTF_Batch;
+
+typedef enum {
+    PARSE_ERROR_NONE,
+    PARSE_ERROR_INVALID,
+    PARSE_ERROR_OVERFLOW,
+    PARSE_ERROR_OUT_OF_BOUNDS,
+} Parse_Error;
+
+typedef struct {
+    Parse_Error error;
+    u64         value;
+    isize       units;
+} Parse_U64;
+
+typedef struct {
+    Parse_Error error;
+    i64         value;
+    isize       units;
+} Parse_I64;
+
+typedef struct {
+    Parse_Error error;
+    f64         value;
+    isize       units;
+} Parse_F64;
+
 typedef struct {
     u8*   memory;
     isize length;
@@ -60,6 +112,25 @@ typedef struct {
 
 typedef String_8 String;
 
+typedef struct {
+    u8    pending[4];
+    isize count;
+} UTF8_Stream;
+
+typedef struct {
+    isize* offsets;
+    isize  count;
+    isize  capacity;
+    isize  step;
+    isize  points;
+    isize  length;
+} UTF8_Index;
+
+typedef struct {
+    String_8 string;
+    isize    offset;
+} Str8_Split;
+
 typedef struct {
     u16*  memory;
     isize length;
@@ -75,11 +146,163 @@ typedef struct {
     isize length;
 } Mem_Block;
 
+typedef bool (*Mem_Commit)(Mem_Block block);
+
+typedef Mem_Block (*Mem_Reserve)(isize bytes);
+
+typedef void (*Mem_Release)(Mem_Block block);
+
+typedef struct Mem_Chunk {
+    struct Mem_Chunk* prev;
+    Mem_Block         block;
+    isize             base;
+} Mem_Chunk;
+
+typedef struct {
+    const char* file;
+    isize       line;
+    u64         pushes;
+    u64         bytes;
+    u64         waste;
+} Mem_Site;
+
+typedef struct {
+    Mem_Site sites[256];
+    isize    count;
+    isize    peak;
+    u64      dropped;
+    u64      pushes;
+    u64      pops;
+    u64      bytes;
+    u64      waste;
+} Mem_Stats;
+
+typedef struct {
+    u8*         memory;
+    isize       length;
+    isize       offset;
+    isize       committed;
+    isize       step;
+    Mem_Commit  commit;
+    Mem_Chunk*  chunk;
+    Mem_Chunk*  spare;
+    isize       size;
+    isize       growth;
+    Mem_Reserve reserve;
+    Mem_Release release;
+
+#if PAX_ARENA_STATS
+
+    Mem_Stats* stats;
+
+#endif
+} Mem_Arena;
+
+typedef struct {
+    Mem_Arena* arena;
+    isize      marker;
+} Mem_Temp;
+
+typedef struct Mem_Slot {
+    struct Mem_Slot* next;
+} Mem_Slot;
+
+typedef struct Mem_Slab {
+    struct Mem_Slab* next;
+    Mem_Block        block;
+} Mem_Slab;
+
+typedef struct {
+    Mem_Arena* arena;
+    Mem_Slot*  free;
+    Mem_Slab*  slabs;
+    Mem_Slab*  slab;
+    isize      offset;
+    isize      size;
+    isize      stride;
+    isize      align;
+    isize      slots;
+    isize      count;
+} Mem_Pool;
+
+typedef struct Mem_Heap_Node {
+    struct Mem_Heap_Node* prev;
+    isize                 size;
+
+    alignas(16) struct Mem_Heap_Node* next_free;
+    struct Mem_Heap_Node*             prev_free;
+} Mem_Heap_Node;
+
+typedef struct {
+    Mem_Block      block;
+    Mem_Heap_Node* heads[32][16];
+    u32            seconds[32];
+    u64            firsts;
+    isize          used;
+    isize          free;
+    isize          count;
+} Mem_Heap;
+
+typedef struct {
+    isize used;
+    isize free;
+    isize largest;
+    isize count;
+    f64   fragmentation;
+} Mem_Heap_Stats;
+
 typedef struct {
     u8*   memory;
     isize length;
-    isize offset;
-} Mem_Arena;
+    isize chunk;
+    isize epoch;
+
+    alignas(64) isize offset;
+} Mem_Shared_Arena;
+
+typedef struct {
+    Mem_Shared_Arena* shared;
+    u8*               memory;
+    isize             length;
+    isize             offset;
+    isize             epoch;
+} Mem_Shared_Cache;
+
+struct Mem_Scope {
+    Mem_Temp temp;
+
+    Mem_Scope(Mem_Temp value);
+
+    Mem_Scope(const Mem_Scope& other) = delete;
+    Mem_Scope(Mem_Scope&& other)      = delete;
+
+    Mem_Scope& operator=(const Mem_Scope& other) = delete;
+    Mem_Scope& operator=(Mem_Scope&& other)      = delete;
+
+    ~Mem_Scope();
+};
+
+typedef struct {
+    u64   hash;
+    isize handle;
+} Intern_Slot;
+
+typedef struct {
+    Intern_Slot* slots;
+    String_8*    strings;
+    isize        capacity;
+    isize        limit;
+    isize        count;
+    Mem_Block    block;
+    Mem_Block    spare;
+} Intern_Table;
+
+typedef struct {
+    Mem_Arena* arena;
+    u8*        memory;
+    isize      length;
+    isize      capacity;
+} Str8_Builder;
 
 //
 // Values
@@ -94,10 +317,37 @@ static const String_8 UTF_ERROR_NAMES[] = {
     PAX_STR_8(PAX_TO_STRING(UTF_ERROR_OUT_OF_BOUNDS)),
 };
 
+static const String_8 PARSE_ERROR_NAMES[] = {
+    PAX_STR_8(PAX_TO_STRING(PARSE_ERROR_NONE)),
+    PAX_STR_8(PAX_TO_STRING(PARSE_ERROR_INVALID)),
+    PAX_STR_8(PAX_TO_STRING(PARSE_ERROR_OVERFLOW)),
+    PAX_STR_8(PAX_TO_STRING(PARSE_ERROR_OUT_OF_BOUNDS)),
+};
+
 //
 // Procs
 //
 
+/* Bits */
+
+isize bits_count_trailing(u64 value);
+
+isize bits_count_leading(u64 value);
+
+isize bits_count_ones(u64 value);
+
+u64 bits_load_u64(u8* memory);
+
+u64 bits_find_zero(u64 value);
+
+u32 bits_load_u32(u8* memory);
+
+u64 bits_mul_u128(u64 value, u64 other, u64* high);
+
+f64 bits_to_f64(u64 value);
+
+u64 bits_from_f64(f64 value);
+
 /* Unicode */
 
 bool unicode_is_valid(u32 value);
@@ -120,19 +370,46 @@ bool utf8_is_trailing(u8 value);
 
 bool utf8_is_overlong(u32 value, isize units);
 
+isize utf8_get_tail(u8* memory, isize length);
+
 bool str8_init(String_8* self, u8* value, isize limit);
 
 UTF_Result str8_encode(String_8 self, isize index, u32 value);
 
 UTF_Result str8_decode(String_8 self, isize index);
 
+UTF_Batch str8_encode_many(String_8 self, isize index, String_32 values);
+
+UTF_Batch str8_decode_many(String_8 self, isize index, String_32 buffer);
+
+UTF_Check str8_validate(String_8 self);
+
+isize str8_count_ascii(String_8 self, isize index);
+
 isize str8_count_as_utf16(String_8 self);
 
 isize str8_count_as_utf32(String_8 self);
 
-bool str8_to_utf16(String_8 self, String_16* string, Mem_Arena* arena);
+bool str8_to_utf16(String_8 self, String_16* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+bool str8_to_utf32(String_8 self, String_32* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+// On failure a stream call leaves the stream as it was before the call,
+// so the chunk can be retried or the stream reset with '= {}'.
+
+bool utf8_stream_to_utf16(UTF8_Stream* self, String_8 chunk, String_16* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+bool utf8_stream_to_utf32(UTF8_Stream* self, String_8 chunk, String_32* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+bool utf8_stream_finish(UTF8_Stream* self);
+
+bool utf8_index_init(UTF8_Index* self, String_8 string, isize step, Mem_Arena* arena PAX_SITE_PARAMS);
+
+bool utf8_index_append(UTF8_Index* self, String_8 string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+isize utf8_index_to_offset(UTF8_Index* self, String_8 string, isize point);
 
-bool str8_to_utf32(String_8 self, String_32* string, Mem_Arena* arena);
+isize utf8_index_to_point(UTF8_Index* self, String_8 string, isize offset);
 
 /* UTF-16 */
 
@@ -146,13 +423,19 @@ UTF_Result str16_encode(String_16 self, isize index, u32 value);
 
 UTF_Result str16_decode(String_16 self, isize index);
 
+UTF_Batch str16_encode_many(String_16 self, isize index, String_32 values);
+
+UTF_Batch str16_decode_many(String_16 self, isize index, String_32 buffer);
+
+isize str16_count_ascii(String_16 self, isize index);
+
 isize str16_count_as_utf8(String_16 self);
 
 isize str16_count_as_utf32(String_16 self);
 
-bool str16_to_utf8(String_16 self, String_8* string, Mem_Arena* arena);
+bool str16_to_utf8(String_16 self, String_8* string, Mem_Arena* arena PAX_SITE_PARAMS);
 
-bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena);
+bool str16_to_utf32(String_16 self, String_32* string, Mem_Arena* arena PAX_SITE_PARAMS);
 
 /* UTF-32 */
 
@@ -162,13 +445,73 @@ UTF_Result str32_encode(String_32 self, isize index, u32 value);
 
 UTF_Result str32_decode(String_32 self, isize index);
 
+isize str32_count_ascii(String_32 self, isize index);
+
 isize str32_count_as_utf8(String_32 self);
 
 isize str32_count_as_utf16(String_32 self);
 
-bool str32_to_utf8(String_32 self, String_8* string, Mem_Arena* arena);
+bool str32_to_utf8(String_32 self, String_8* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+bool str32_to_utf16(String_32 self, String_16* string, Mem_Arena* arena PAX_SITE_PARAMS);
+
+/* Search */
+
+bool str8_is_equal(String_8 self, String_8 value);
+
+isize str8_find_byte(String_8 self, isize index, u8 value);
+
+isize str8_find(String_8 self, isize index, String_8 value);
+
+isize str8_find_any(String_8 self, isize index, String_8 values);
+
+void str8_split_init(Str8_Split* self, String_8 string);
+
+bool str8_split_next(Str8_Split* self, String_8 delimiter, String_8* value);
+
+bool str8_split_next_line(Str8_Split* self, String_8* value);
+
+/* Hash */
+
+u64 hash_bytes(u8* memory, isize length, u64 seed);
+
+u64 hash_str8(String_8 value, u64 seed);
+
+u64 hash_block(Mem_Block value, u64 seed);
+
+/* Intern */
+
+bool intern_init(Intern_Table* self, isize capacity, Mem_Arena* arena PAX_SITE_PARAMS);
+
+isize intern_insert(Intern_Table* self, String_8 value, Mem_Arena* arena PAX_SITE_PARAMS);
+
+isize intern_find(Intern_Table* self, String_8 value);
+
+String_8 intern_get(Intern_Table* self, isize handle);
+
+/* Parse */
+
+Parse_U64 str8_parse_u64(String_8 self, isize index);
+
+Parse_I64 str8_parse_i64(String_8 self, isize index);
+
+Parse_F64 str8_parse_f64(String_8 self, isize index);
+
+/* Format */
+
+void str8_builder_init(Str8_Builder* self, Mem_Arena* arena);
+
+bool str8_builder_push_str8(Str8_Builder* self, String_8 value PAX_SITE_PARAMS);
 
-bool str32_to_utf16(String_32 self, String_16* string, Mem_Arena* arena);
+bool str8_builder_push_u64(Str8_Builder* self, u64 value PAX_SITE_PARAMS);
+
+bool str8_builder_push_i64(Str8_Builder* self, i64 value PAX_SITE_PARAMS);
+
+bool str8_builder_push_hex(Str8_Builder* self, u64 value, isize digits PAX_SITE_PARAMS);
+
+bool str8_builder_push_f64(Str8_Builder* self, f64 value PAX_SITE_PARAMS);
+
+String_8 str8_builder_finish(Str8_Builder* self);
 
 /* Arena */
 
@@ -176,14 +519,82 @@ isize align_by(isize value, isize align);
 
 void arena_init(Mem_Arena* self, Mem_Block block);
 
+void arena_init_lazy(Mem_Arena* self, Mem_Block block, isize step, Mem_Commit commit);
+
+void arena_init_chain(Mem_Arena* self, isize size, isize growth, Mem_Reserve reserve, Mem_Release release);
+
+void arena_release(Mem_Arena* arena);
+
 void arena_clear(Mem_Arena* arena);
 
-Mem_Block arena_push(Mem_Arena* arena, isize bytes, isize align);
+Mem_Block arena_push(Mem_Arena* arena, isize bytes, isize align PAX_SITE_PARAMS);
+
+Mem_Block arena_push_array(Mem_Arena* arena, isize items, isize stride, isize align PAX_SITE_PARAMS);
+
+Mem_Block arena_push_uninit(Mem_Arena* arena, isize bytes, isize align PAX_SITE_PARAMS);
+
+Mem_Block arena_push_array_uninit(Mem_Arena* arena, isize items, isize stride, isize align PAX_SITE_PARAMS);
 
-Mem_Block arena_push_array(Mem_Arena* arena, isize items, isize stride, isize align);
+Mem_Block arena_resize(Mem_Arena* arena, Mem_Block block, isize bytes, isize align PAX_SITE_PARAMS);
 
 bool arena_pop(Mem_Arena* arena, isize marker);
 
+Mem_Temp arena_temp_begin(Mem_Arena* arena);
+
+void arena_temp_end(Mem_Temp temp);
+
+#if PAX_ARENA_STATS
+
+void arena_stats_attach(Mem_Arena* arena, Mem_Stats* stats);
+
+bool arena_stats_dump(Mem_Stats* stats, Str8_Builder* builder);
+
+#endif
+
+/* Pool */
+
+bool pool_init(Mem_Pool* self, Mem_Arena* arena, isize size, isize align);
+
+Mem_Block pool_push(Mem_Pool* pool PAX_SITE_PARAMS);
+
+Mem_Block pool_push_uninit(Mem_Pool* pool PAX_SITE_PARAMS);
+
+bool pool_pop(Mem_Pool* pool, ptr memory);
+
+void pool_clear(Mem_Pool* pool);
+
+/* Heap */
+
+bool heap_init(Mem_Heap* self, Mem_Block block);
+
+Mem_Block heap_push(Mem_Heap* heap, isize bytes, isize align);
+
+Mem_Block heap_push_uninit(Mem_Heap* heap, isize bytes, isize align);
+
+bool heap_pop(Mem_Heap* heap, ptr memory);
+
+Mem_Heap_Stats heap_stats(Mem_Heap* heap);
+
+/* Shared Arena */
+
+void shared_arena_init(Mem_Shared_Arena* self, Mem_Block block, isize chunk);
+
+Mem_Block shared_arena_push(Mem_Shared_Arena* arena, isize bytes, isize align);
+
+Mem_Block shared_arena_push_uninit(Mem_Shared_Arena* arena, isize bytes, isize align);
+
+isize shared_arena_marker(Mem_Shared_Arena* arena);
+
+bool shared_arena_pop(Mem_Shared_Arena* arena, isize marker);
+
+void shared_arena_clear(Mem_Shared_Arena* arena);
+
+void shared_cache_init(Mem_Shared_Cache* self, Mem_Shared_Arena* arena);
+
+Mem_Block shared_cache_push(Mem_Shared_Cache* cache, isize bytes, isize align);
+
+Mem_Block shared_cache_push_uninit(Mem_Shared_Cache* cache, isize bytes, isize align);
+
 } // namespace pax
 
 #endif // PAX_BASE_HPP
@@ -3,7 +3,8 @@
 
 #define PAX_SYSTEM_UNKNOWN 0
 #define PAX_SYSTEM_WINDOWS 1
-#define PAX_SYSTEM_MAX     2
+#define PAX_SYSTEM_LINUX   2
+#define PAX_SYSTEM_MAX     3
 
 #define PAX_COMP_UNKNOWN 0
 #define PAX_COMP_MSVC    1
@@ -19,12 +20,22 @@
 #define PAX_LANG_CPP     2
 #define PAX_LANG_MAX     3
 
+#define PAX_SIMD_NONE 0
+#define PAX_SIMD_SSE4 1
+#define PAX_SIMD_AVX2 2
+#define PAX_SIMD_NEON 3
+#define PAX_SIMD_MAX  4
+
 #ifndef PAX_SYSTEM
 
     #if _WIN32
 
         #define PAX_SYSTEM PAX_SYSTEM_WINDOWS
 
+    #elif __linux__
+
+        #define PAX_SYSTEM PAX_SYSTEM_LINUX
+
     #else
 
         #define PAX_SYSTEM PAX_SYSTEM_UNKNOWN
@@ -65,6 +76,58 @@
 
 #endif
 
+#ifndef PAX_SIMD
+
+    #if __AVX2__
+
+        #define PAX_SIMD PAX_SIMD_AVX2
+
+    #elif __SSE4_1__ || __AVX__
+
+        #define PAX_SIMD PAX_SIMD_SSE4
+
+    #elif __aarch64__ || _M_ARM64
+
+        #define PAX_SIMD PAX_SIMD_NEON
+
+    #else
+
+        #define PAX_SIMD PAX_SIMD_NONE
+
+    #endif
+
+#endif
+
+#ifndef PAX_ARENA_STATS
+
+    #define PAX_ARENA_STATS 0
+
+#endif
+
+#ifndef PAX_ASAN
+
+    #if __SANITIZE_ADDRESS__
+
+        #define PAX_ASAN 1
+
+    #elif defined(__has_feature)
+
+        #if __has_feature(address_sanitizer)
+
+            #define PAX_ASAN 1
+
+        #endif
+
+    #endif
+
+    #ifndef PAX_ASAN
+
+        #define PAX_ASAN 0
+
+    #endif
+
+#endif
+
 #if PAX_ARCH == PAX_ARCH_UNKNOWN
 
     #error "Unable to detect architecture..."
@@ -78,8 +141,8 @@ namespace pax {
     using i32 = int;
     using u32 = unsigned int;
 
-    using isize = i32;
-    using usize = u32;
+    using isize = long long;
+    using usize = unsigned long long;
 
 #elif PAX_ARCH == PAX_ARCH_32
 
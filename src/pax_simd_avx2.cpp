@@ -0,0 +1,199 @@
+#include "pax_base.hpp"
+
+#include <immintrin.h>
+
+namespace pax {
+
+//
+// Types
+//
+
+typedef __m256i Simd_U8;
+
+//
+// Values
+//
+
+static const isize SIMD_WIDTH = 32;
+
+//
+// Procs
+//
+
+static Simd_U8 simd_load(u8* memory)
+{
+    return _mm256_loadu_si256((__m256i*)(memory));
+}
+
+static void simd_store(u8* memory, Simd_U8 value)
+{
+    _mm256_storeu_si256((__m256i*)(memory), value);
+}
+
+static Simd_U8 simd_splat(u8 value)
+{
+    return _mm256_set1_epi8((char)(value));
+}
+
+static Simd_U8 simd_table(const u8* table)
+{
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((__m128i*)(table)));
+}
+
+static Simd_U8 simd_and(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_and_si256(self, value);
+}
+
+static Simd_U8 simd_or(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_or_si256(self, value);
+}
+
+static Simd_U8 simd_xor(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_xor_si256(self, value);
+}
+
+static Simd_U8 simd_sub_sat(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_subs_epu8(self, value);
+}
+
+static Simd_U8 simd_add(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_add_epi8(self, value);
+}
+
+static Simd_U8 simd_shl(Simd_U8 self, isize count)
+{
+    return _mm256_and_si256(_mm256_slli_epi16(self, count),
+        _mm256_set1_epi8((char)(0xff << count)));
+}
+
+static Simd_U8 simd_shr(Simd_U8 self, isize count)
+{
+    return _mm256_and_si256(_mm256_srli_epi16(self, count),
+        _mm256_set1_epi8((char)(0xff >> count)));
+}
+
+static Simd_U8 simd_cmp_eq(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_cmpeq_epi8(self, value);
+}
+
+static Simd_U8 simd_cmp_ge(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_cmpeq_epi8(_mm256_max_epu8(self, value), self);
+}
+
+static Simd_U8 simd_select(Simd_U8 mask, Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_blendv_epi8(value, self, mask);
+}
+
+static Simd_U8 simd_lookup(Simd_U8 table, Simd_U8 index)
+{
+    return _mm256_shuffle_epi8(table, index);
+}
+
+static Simd_U8 simd_prev_1(Simd_U8 self)
+{
+    return _mm256_alignr_epi8(self,
+        _mm256_permute2x128_si256(self, self, 0x08), 15);
+}
+
+static Simd_U8 simd_prev_2(Simd_U8 self)
+{
+    return _mm256_alignr_epi8(self,
+        _mm256_permute2x128_si256(self, self, 0x08), 14);
+}
+
+static Simd_U8 simd_prev_3(Simd_U8 self)
+{
+    return _mm256_alignr_epi8(self,
+        _mm256_permute2x128_si256(self, self, 0x08), 13);
+}
+
+static Simd_U8 simd_next_1(Simd_U8 self)
+{
+    return _mm256_alignr_epi8(
+        _mm256_permute2x128_si256(self, self, 0x81), self, 1);
+}
+
+static Simd_U8 simd_next_2(Simd_U8 self)
+{
+    return _mm256_alignr_epi8(
+        _mm256_permute2x128_si256(self, self, 0x81), self, 2);
+}
+
+static bool simd_any(Simd_U8 self)
+{
+    return _mm256_testz_si256(self, self) == 0;
+}
+
+static u32 simd_mask(Simd_U8 self)
+{
+    return (u32)(_mm256_movemask_epi8(self));
+}
+
+static void simd_load_wide(u8* memory, Simd_U8* low, Simd_U8* high)
+{
+    __m256i first  = _mm256_loadu_si256((__m256i*)(memory));
+    __m256i second = _mm256_loadu_si256((__m256i*)(memory + 32));
+    __m256i mask   = _mm256_set1_epi16(0x00ff);
+
+    *low = _mm256_packus_epi16(_mm256_and_si256(first, mask),
+        _mm256_and_si256(second, mask));
+
+    *high = _mm256_packus_epi16(_mm256_srli_epi16(first, 8),
+        _mm256_srli_epi16(second, 8));
+
+    *low  = _mm256_permute4x64_epi64(*low,  0xd8);
+    *high = _mm256_permute4x64_epi64(*high, 0xd8);
+}
+
+static void simd_store_wide(u8* memory, Simd_U8 low, Simd_U8 high)
+{
+    __m256i first  = _mm256_unpacklo_epi8(low, high);
+    __m256i second = _mm256_unpackhi_epi8(low, high);
+
+    _mm256_storeu_si256((__m256i*)(memory),
+        _mm256_permute2x128_si256(first, second, 0x20));
+
+    _mm256_storeu_si256((__m256i*)(memory + 32),
+        _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+static Simd_U8 simd_splat_u32(u32 value)
+{
+    return _mm256_set1_epi32((int)(value));
+}
+
+static Simd_U8 simd_add_u64(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_add_epi64(self, value);
+}
+
+static Simd_U8 simd_mul_u32(Simd_U8 self, Simd_U8 value)
+{
+    return _mm256_mul_epu32(self, value);
+}
+
+static Simd_U8 simd_shl_u64(Simd_U8 self, isize count)
+{
+    return _mm256_slli_epi64(self, (int)(count));
+}
+
+static Simd_U8 simd_shr_u64(Simd_U8 self, isize count)
+{
+    return _mm256_srli_epi64(self, (int)(count));
+}
+
+static Simd_U8 simd_swap_u64(Simd_U8 self)
+{
+    return _mm256_shuffle_epi32(self, 0x4e);
+}
+
+} // namespace pax
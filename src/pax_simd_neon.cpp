@@ -0,0 +1,195 @@
+#include "pax_base.hpp"
+
+#include <arm_neon.h>
+
+namespace pax {
+
+//
+// Types
+//
+
+typedef uint8x16_t Simd_U8;
+
+//
+// Values
+//
+
+static const isize SIMD_WIDTH = 16;
+
+static const u8 SIMD_MASK_BITS[16] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+};
+
+//
+// Procs
+//
+
+static Simd_U8 simd_load(u8* memory)
+{
+    return vld1q_u8(memory);
+}
+
+static void simd_store(u8* memory, Simd_U8 value)
+{
+    vst1q_u8(memory, value);
+}
+
+static Simd_U8 simd_splat(u8 value)
+{
+    return vdupq_n_u8(value);
+}
+
+static Simd_U8 simd_table(const u8* table)
+{
+    return vld1q_u8(table);
+}
+
+static Simd_U8 simd_and(Simd_U8 self, Simd_U8 value)
+{
+    return vandq_u8(self, value);
+}
+
+static Simd_U8 simd_or(Simd_U8 self, Simd_U8 value)
+{
+    return vorrq_u8(self, value);
+}
+
+static Simd_U8 simd_xor(Simd_U8 self, Simd_U8 value)
+{
+    return veorq_u8(self, value);
+}
+
+static Simd_U8 simd_sub_sat(Simd_U8 self, Simd_U8 value)
+{
+    return vqsubq_u8(self, value);
+}
+
+static Simd_U8 simd_add(Simd_U8 self, Simd_U8 value)
+{
+    return vaddq_u8(self, value);
+}
+
+static Simd_U8 simd_shl(Simd_U8 self, isize count)
+{
+    return vshlq_u8(self, vdupq_n_s8((i8)(count)));
+}
+
+static Simd_U8 simd_shr(Simd_U8 self, isize count)
+{
+    return vshlq_u8(self, vdupq_n_s8((i8)(-count)));
+}
+
+static Simd_U8 simd_cmp_eq(Simd_U8 self, Simd_U8 value)
+{
+    return vceqq_u8(self, value);
+}
+
+static Simd_U8 simd_cmp_ge(Simd_U8 self, Simd_U8 value)
+{
+    return vcgeq_u8(self, value);
+}
+
+static Simd_U8 simd_select(Simd_U8 mask, Simd_U8 self, Simd_U8 value)
+{
+    return vbslq_u8(mask, self, value);
+}
+
+static Simd_U8 simd_lookup(Simd_U8 table, Simd_U8 index)
+{
+    return vqtbl1q_u8(table, index);
+}
+
+static Simd_U8 simd_prev_1(Simd_U8 self)
+{
+    return vextq_u8(vdupq_n_u8(0), self, 15);
+}
+
+static Simd_U8 simd_prev_2(Simd_U8 self)
+{
+    return vextq_u8(vdupq_n_u8(0), self, 14);
+}
+
+static Simd_U8 simd_prev_3(Simd_U8 self)
+{
+    return vextq_u8(vdupq_n_u8(0), self, 13);
+}
+
+static Simd_U8 simd_next_1(Simd_U8 self)
+{
+    return vextq_u8(self, vdupq_n_u8(0), 1);
+}
+
+static Simd_U8 simd_next_2(Simd_U8 self)
+{
+    return vextq_u8(self, vdupq_n_u8(0), 2);
+}
+
+static bool simd_any(Simd_U8 self)
+{
+    return vmaxvq_u8(self) != 0;
+}
+
+static u32 simd_mask(Simd_U8 self)
+{
+    Simd_U8 temp = vandq_u8(vcltzq_s8(vreinterpretq_s8_u8(self)),
+        vld1q_u8(SIMD_MASK_BITS));
+
+    temp = vpaddq_u8(temp, temp);
+    temp = vpaddq_u8(temp, temp);
+    temp = vpaddq_u8(temp, temp);
+
+    return vgetq_lane_u16(vreinterpretq_u16_u8(temp), 0);
+}
+
+static void simd_load_wide(u8* memory, Simd_U8* low, Simd_U8* high)
+{
+    uint8x16x2_t pair = vld2q_u8(memory);
+
+    *low  = pair.val[0];
+    *high = pair.val[1];
+}
+
+static void simd_store_wide(u8* memory, Simd_U8 low, Simd_U8 high)
+{
+    uint8x16x2_t pair = {{low, high}};
+
+    vst2q_u8(memory, pair);
+}
+
+static Simd_U8 simd_splat_u32(u32 value)
+{
+    return vreinterpretq_u8_u32(vdupq_n_u32(value));
+}
+
+static Simd_U8 simd_add_u64(Simd_U8 self, Simd_U8 value)
+{
+    return vreinterpretq_u8_u64(vaddq_u64(vreinterpretq_u64_u8(self),
+        vreinterpretq_u64_u8(value)));
+}
+
+static Simd_U8 simd_mul_u32(Simd_U8 self, Simd_U8 value)
+{
+    return vreinterpretq_u8_u64(vmull_u32(vmovn_u64(vreinterpretq_u64_u8(self)),
+        vmovn_u64(vreinterpretq_u64_u8(value))));
+}
+
+static Simd_U8 simd_shl_u64(Simd_U8 self, isize count)
+{
+    return vreinterpretq_u8_u64(vshlq_u64(vreinterpretq_u64_u8(self),
+        vdupq_n_s64((i64)(count))));
+}
+
+static Simd_U8 simd_shr_u64(Simd_U8 self, isize count)
+{
+    return vreinterpretq_u8_u64(vshlq_u64(vreinterpretq_u64_u8(self),
+        vdupq_n_s64((i64)(-count))));
+}
+
+static Simd_U8 simd_swap_u64(Simd_U8 self)
+{
+    return vreinterpretq_u8_u64(vextq_u64(vreinterpretq_u64_u8(self),
+        vreinterpretq_u64_u8(self), 1));
+}
+
+} // namespace pax
@@ -0,0 +1,187 @@
+#include "pax_base.hpp"
+
+#include <smmintrin.h>
+
+namespace pax {
+
+//
+// Types
+//
+
+typedef __m128i Simd_U8;
+
+//
+// Values
+//
+
+static const isize SIMD_WIDTH = 16;
+
+//
+// Procs
+//
+
+static Simd_U8 simd_load(u8* memory)
+{
+    return _mm_loadu_si128((__m128i*)(memory));
+}
+
+static void simd_store(u8* memory, Simd_U8 value)
+{
+    _mm_storeu_si128((__m128i*)(memory), value);
+}
+
+static Simd_U8 simd_splat(u8 value)
+{
+    return _mm_set1_epi8((char)(value));
+}
+
+static Simd_U8 simd_table(const u8* table)
+{
+    return _mm_loadu_si128((__m128i*)(table));
+}
+
+static Simd_U8 simd_and(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_and_si128(self, value);
+}
+
+static Simd_U8 simd_or(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_or_si128(self, value);
+}
+
+static Simd_U8 simd_xor(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_xor_si128(self, value);
+}
+
+static Simd_U8 simd_sub_sat(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_subs_epu8(self, value);
+}
+
+static Simd_U8 simd_add(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_add_epi8(self, value);
+}
+
+static Simd_U8 simd_shl(Simd_U8 self, isize count)
+{
+    return _mm_and_si128(_mm_slli_epi16(self, count),
+        _mm_set1_epi8((char)(0xff << count)));
+}
+
+static Simd_U8 simd_shr(Simd_U8 self, isize count)
+{
+    return _mm_and_si128(_mm_srli_epi16(self, count),
+        _mm_set1_epi8((char)(0xff >> count)));
+}
+
+static Simd_U8 simd_cmp_eq(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_cmpeq_epi8(self, value);
+}
+
+static Simd_U8 simd_cmp_ge(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_cmpeq_epi8(_mm_max_epu8(self, value), self);
+}
+
+static Simd_U8 simd_select(Simd_U8 mask, Simd_U8 self, Simd_U8 value)
+{
+    return _mm_blendv_epi8(value, self, mask);
+}
+
+static Simd_U8 simd_lookup(Simd_U8 table, Simd_U8 index)
+{
+    return _mm_shuffle_epi8(table, index);
+}
+
+static Simd_U8 simd_prev_1(Simd_U8 self)
+{
+    return _mm_slli_si128(self, 1);
+}
+
+static Simd_U8 simd_prev_2(Simd_U8 self)
+{
+    return _mm_slli_si128(self, 2);
+}
+
+static Simd_U8 simd_prev_3(Simd_U8 self)
+{
+    return _mm_slli_si128(self, 3);
+}
+
+static Simd_U8 simd_next_1(Simd_U8 self)
+{
+    return _mm_srli_si128(self, 1);
+}
+
+static Simd_U8 simd_next_2(Simd_U8 self)
+{
+    return _mm_srli_si128(self, 2);
+}
+
+static bool simd_any(Simd_U8 self)
+{
+    return _mm_testz_si128(self, self) == 0;
+}
+
+static u32 simd_mask(Simd_U8 self)
+{
+    return (u32)(_mm_movemask_epi8(self));
+}
+
+static void simd_load_wide(u8* memory, Simd_U8* low, Simd_U8* high)
+{
+    __m128i first  = _mm_loadu_si128((__m128i*)(memory));
+    __m128i second = _mm_loadu_si128((__m128i*)(memory + 16));
+    __m128i mask   = _mm_set1_epi16(0x00ff);
+
+    *low = _mm_packus_epi16(_mm_and_si128(first, mask),
+        _mm_and_si128(second, mask));
+
+    *high = _mm_packus_epi16(_mm_srli_epi16(first, 8),
+        _mm_srli_epi16(second, 8));
+}
+
+static void simd_store_wide(u8* memory, Simd_U8 low, Simd_U8 high)
+{
+    _mm_storeu_si128((__m128i*)(memory),
+        _mm_unpacklo_epi8(low, high));
+
+    _mm_storeu_si128((__m128i*)(memory + 16),
+        _mm_unpackhi_epi8(low, high));
+}
+
+static Simd_U8 simd_splat_u32(u32 value)
+{
+    return _mm_set1_epi32((int)(value));
+}
+
+static Simd_U8 simd_add_u64(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_add_epi64(self, value);
+}
+
+static Simd_U8 simd_mul_u32(Simd_U8 self, Simd_U8 value)
+{
+    return _mm_mul_epu32(self, value);
+}
+
+static Simd_U8 simd_shl_u64(Simd_U8 self, isize count)
+{
+    return _mm_slli_epi64(self, (int)(count));
+}
+
+static Simd_U8 simd_shr_u64(Simd_U8 self, isize count)
+{
+    return _mm_srli_epi64(self, (int)(count));
+}
+
+static Simd_U8 simd_swap_u64(Simd_U8 self)
+{
+    return _mm_shuffle_epi32(self, 0x4e);
+}
+
+} // namespace pax
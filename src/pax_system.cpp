@@ -4,6 +4,10 @@
 
     #include "pax_system_windows.cpp"
 
+#elif PAX_SYSTEM == PAX_SYSTEM_LINUX
+
+    #include "pax_system_linux.cpp"
+
 #endif
 
 namespace pax {
@@ -13,17 +17,114 @@ isize system_get_page_size()
     return system_get_page_size_impl();
 }
 
+isize system_get_large_page_size()
+{
+    static const isize result = system_get_large_page_size_impl();
+
+    return result;
+}
+
 Mem_Block system_reserve(isize pages)
 {
     return system_reserve_impl(pages);
 }
 
+bool system_commit(Mem_Block block)
+{
+    return system_commit_impl(block);
+}
+
+bool system_decommit(Mem_Block block)
+{
+    return system_decommit_impl(block);
+}
+
+Mem_Block system_acquire(isize bytes)
+{
+    Mem_Block result = {};
+
+    isize page = system_get_page_size();
+
+    if (bytes <= 0 || bytes > PAX_ISIZE_MAX - page)
+        return result;
+
+    Mem_Block block = system_reserve((bytes + page - 1) / page);
+
+    if (block.memory == 0) return result;
+
+    if (system_commit(block) == false) {
+        system_release(block);
+
+        return result;
+    }
+
+    return block;
+}
+
+Mem_Block system_acquire_large(isize bytes, isize* page)
+{
+    Mem_Block result = {};
+
+    isize large = system_get_large_page_size();
+
+    if (bytes <= 0) return result;
+
+    if (large > system_get_page_size() && bytes <= PAX_ISIZE_MAX - large) {
+        isize length = (bytes + large - 1) / large * large;
+
+        result = system_acquire_large_impl(length, page);
+
+        if (result.memory != 0) return result;
+    }
+
+    result = system_acquire(bytes);
+
+    if (result.memory != 0 && page != 0)
+        *page = system_get_page_size();
+
+    return result;
+}
+
 void system_release(Mem_Block block)
 {
     system_release_impl(block);
 }
 
-File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena)
+Mem_Block system_acquire_large_block(isize bytes)
+{
+    return system_acquire_large(bytes, 0);
+}
+
+void arena_init_chain_large(Mem_Arena* self, isize size, isize growth)
+{
+    arena_init_chain(self, size, growth, system_acquire_large_block, system_release);
+}
+
+static const isize SCRATCH_COUNT = 2;
+static const isize SCRATCH_SIZE  = 64 * 1024;
+
+static thread_local Mem_Arena scratch_arenas[SCRATCH_COUNT] = {};
+
+Mem_Temp scratch_begin(Mem_Arena* conflict)
+{
+    Mem_Arena* arena = &scratch_arenas[0];
+
+    if (arena == conflict)
+        arena = &scratch_arenas[1];
+
+    if (arena->reserve == 0)
+        arena_init_chain(arena, SCRATCH_SIZE, 2, system_acquire, system_release);
+
+    return arena_temp_begin(arena);
+}
+
+void scratch_release()
+{
+    for (isize i = 0; i < SCRATCH_COUNT; i += 1)
+        arena_release(&scratch_arenas[i]);
+}
+
+File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_DEFINE)
 {
     File_Impl impl = {};
 
@@ -34,7 +135,7 @@ File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena)
     isize bytes = PAX_SIZE_OF(File_Impl);
     isize align = PAX_ALIGN_OF(File_Impl);
 
-    Mem_Block block = arena_push(arena, bytes, align);
+    Mem_Block block = arena_push_uninit(arena, bytes, align PAX_SITE_FORWARD);
 
     if (block.memory != 0) {
         for (isize i = 0; i < bytes; i += 1)
@@ -50,7 +151,7 @@ File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena)
     return FILE_ERROR_ARENA_IS_FULL;
 }
 
-File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* arena)
+File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_DEFINE)
 {
     File_Impl impl = {};
 
@@ -61,7 +162,7 @@ File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* a
     isize bytes = PAX_SIZE_OF(File_Impl);
     isize align = PAX_ALIGN_OF(File_Impl);
 
-    Mem_Block block = arena_push(arena, bytes, align);
+    Mem_Block block = arena_push_uninit(arena, bytes, align PAX_SITE_FORWARD);
 
     if (block.memory != 0) {
         for (isize i = 0; i < bytes; i += 1)
@@ -77,7 +178,7 @@ File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* a
     return FILE_ERROR_ARENA_IS_FULL;
 }
 
-File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* arena)
+File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_DEFINE)
 {
     File_Impl impl = {};
 
@@ -88,7 +189,7 @@ File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* ar
     isize bytes = PAX_SIZE_OF(File_Impl);
     isize align = PAX_ALIGN_OF(File_Impl);
 
-    Mem_Block block = arena_push(arena, bytes, align);
+    Mem_Block block = arena_push_uninit(arena, bytes, align PAX_SITE_FORWARD);
 
     if (block.memory != 0) {
         for (isize i = 0; i < bytes; i += 1)
@@ -104,7 +205,7 @@ File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* ar
     return FILE_ERROR_ARENA_IS_FULL;
 }
 
-File_Error file_open_to_write(File_Handle* self, String_8 filename, Mem_Arena* arena)
+File_Error file_open_to_write(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_DEFINE)
 {
     File_Impl impl = {};
 
@@ -115,7 +216,7 @@ File_Error file_open_to_write(File_Handle* self, String_8 filename, Mem_Arena* a
     isize bytes = PAX_SIZE_OF(File_Impl);
     isize align = PAX_ALIGN_OF(File_Impl);
 
-    Mem_Block block = arena_push(arena, bytes, align);
+    Mem_Block block = arena_push_uninit(arena, bytes, align PAX_SITE_FORWARD);
 
     if (block.memory != 0) {
         for (isize i = 0; i < bytes; i += 1)
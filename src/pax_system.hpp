@@ -55,19 +55,41 @@ static const String_8 FILE_ERROR_NAMES[] = {
 
 isize system_get_page_size();
 
+isize system_get_large_page_size();
+
 Mem_Block system_reserve(isize pages);
 
+bool system_commit(Mem_Block block);
+
+bool system_decommit(Mem_Block block);
+
+Mem_Block system_acquire(isize bytes);
+
+Mem_Block system_acquire_large(isize bytes, isize* page);
+
 void system_release(Mem_Block block);
 
+Mem_Block system_acquire_large_block(isize bytes);
+
+/* Arena */
+
+void arena_init_chain_large(Mem_Arena* self, isize size, isize growth);
+
+/* Scratch */
+
+Mem_Temp scratch_begin(Mem_Arena* conflict);
+
+void scratch_release();
+
 /* File */
 
-File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena);
+File_Error file_create(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_PARAMS);
 
-File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* arena);
+File_Error file_create_always(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_PARAMS);
 
-File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* arena);
+File_Error file_open_to_read(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_PARAMS);
 
-File_Error file_open_to_write(File_Handle* self, String_8 filename, Mem_Arena* arena);
+File_Error file_open_to_write(File_Handle* self, String_8 filename, Mem_Arena* arena PAX_SITE_PARAMS);
 
 void file_close(File_Handle* self);
 
@@ -0,0 +1,280 @@
+#include "pax_system.hpp"
+
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace pax {
+
+//
+// Types
+//
+
+struct File_Impl { int handle; };
+
+//
+// Values
+//
+
+static const isize FILE_READ_CHUNK = 0x7ffff000;
+
+//
+// Procs
+//
+
+isize system_get_page_size_impl()
+{
+    return (isize)(sysconf(_SC_PAGESIZE));
+}
+
+isize system_get_large_page_size_impl()
+{
+    u8    memory[32] = {};
+    isize result     = 0;
+
+    int handle = open("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size",
+        O_RDONLY | O_CLOEXEC);
+
+    if (handle < 0) return result;
+
+    ssize_t bytes = read(handle, memory, PAX_SIZE_OF(memory));
+
+    close(handle);
+
+    for (isize i = 0; i < bytes; i += 1) {
+        if (memory[i] < '0' || memory[i] > '9') break;
+
+        if (result > (PAX_ISIZE_MAX - 9) / 10) return 0;
+
+        result = result * 10 + (memory[i] - '0');
+    }
+
+    if ((result & (result - 1)) != 0) return 0;
+
+    return result;
+}
+
+Mem_Block system_reserve_impl(isize pages)
+{
+    Mem_Block result = {};
+
+    isize page = system_get_page_size();
+
+    if (pages <= 0 || pages > PAX_ISIZE_MAX / page)
+        return result;
+
+    isize length = pages * page;
+
+    void* memory = mmap(0, length, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+    if (memory == MAP_FAILED) return result;
+
+    result.memory = (u8*)(memory);
+    result.length = length;
+
+    return result;
+}
+
+Mem_Block system_acquire_large_impl(isize length, isize* page)
+{
+    Mem_Block result = {};
+
+    isize large = system_get_large_page_size();
+    int   flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+
+#ifdef MAP_HUGE_SHIFT
+    flags |= (int)(bits_count_trailing((u64)(large))) << MAP_HUGE_SHIFT;
+#endif
+
+    void* memory = mmap(0, length, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+    if (memory != MAP_FAILED) {
+        result.memory = (u8*)(memory);
+        result.length = length;
+
+        if (page != 0) *page = large;
+
+        return result;
+    }
+
+    if (length > PAX_ISIZE_MAX - large) return result;
+
+    memory = mmap(0, length + large, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (memory == MAP_FAILED) return result;
+
+    u8* start = (u8*)(memory);
+    u8* align = (u8*)(((u64)(start) + large - 1) & ~((u64)(large) - 1));
+
+    isize head = align - start;
+
+    if (head > 0)         munmap(start, head);
+    if (large - head > 0) munmap(align + length, large - head);
+
+    result.memory = align;
+    result.length = length;
+
+    isize size = large;
+
+    if (madvise(align, length, MADV_HUGEPAGE) != 0)
+        size = system_get_page_size();
+
+    if (page != 0) *page = size;
+
+    return result;
+}
+
+bool system_commit_impl(Mem_Block block)
+{
+    if (block.memory == 0 || block.length <= 0)
+        return false;
+
+    u64 page  = (u64)(system_get_page_size());
+    u64 start = (u64)(block.memory) & ~(page - 1);
+    u64 stop  = ((u64)(block.memory + block.length) + page - 1) & ~(page - 1);
+
+    return mprotect((void*)(start), stop - start, PROT_READ | PROT_WRITE) == 0;
+}
+
+bool system_decommit_impl(Mem_Block block)
+{
+    if (block.memory == 0 || block.length <= 0)
+        return false;
+
+    u64 page  = (u64)(system_get_page_size());
+    u64 start = ((u64)(block.memory) + page - 1) & ~(page - 1);
+    u64 stop  = (u64)(block.memory + block.length) & ~(page - 1);
+
+    if (stop <= start) return true;
+
+    if (madvise((void*)(start), stop - start, MADV_DONTNEED) != 0)
+        return false;
+
+    return mprotect((void*)(start), stop - start, PROT_NONE) == 0;
+}
+
+void system_release_impl(Mem_Block block)
+{
+    if (block.memory != 0)
+        munmap(block.memory, block.length);
+}
+
+File_Error file_open_impl(File_Impl* self, String_8 filename, int flags, Mem_Arena* arena)
+{
+    Mem_Scope scratch = {scratch_begin(arena)};
+
+    Mem_Block block = arena_push_uninit(scratch.temp.arena, filename.length + 1, 1);
+
+    if (block.memory == 0) return FILE_ERROR_ARENA_IS_FULL;
+
+    for (isize i = 0; i < filename.length; i += 1) {
+        block.memory[i] = filename.memory[i];
+
+        if (filename.memory[i] == 0)
+            return FILE_ERROR_PATH_ENCODING;
+    }
+
+    block.memory[filename.length] = 0;
+
+    int handle = open((char*)(block.memory), flags | O_CLOEXEC, 0644);
+
+    if (handle >= 0) {
+        self->handle = handle;
+
+        return FILE_ERROR_NONE;
+    }
+
+    switch (errno) {
+        case ENOENT:  return FILE_ERROR_PATH_INVALID;
+        case ENOTDIR: return FILE_ERROR_PATH_INVALID;
+        case EEXIST:  return FILE_ERROR_PATH_EXISTS;
+    }
+
+    return FILE_ERROR_UNKNOWN;
+}
+
+File_Error file_create_impl(File_Impl* self, String_8 filename, Mem_Arena* arena)
+{
+    return file_open_impl(self, filename, O_RDWR | O_CREAT | O_EXCL, arena);
+}
+
+File_Error file_create_always_impl(File_Impl* self, String_8 filename, Mem_Arena* arena)
+{
+    return file_open_impl(self, filename, O_RDWR | O_CREAT | O_TRUNC, arena);
+}
+
+File_Error file_open_to_read_impl(File_Impl* self, String_8 filename, Mem_Arena* arena)
+{
+    return file_open_impl(self, filename, O_RDONLY, arena);
+}
+
+File_Error file_open_to_write_impl(File_Impl* self, String_8 filename, Mem_Arena* arena)
+{
+    return file_open_impl(self, filename, O_WRONLY, arena);
+}
+
+void file_close_impl(File_Impl* self)
+{
+    if (self->handle >= 0)
+        close(self->handle);
+
+    self->handle = -1;
+}
+
+File_Result file_read_impl(File_Impl* self, Mem_Block* block)
+{
+    File_Result result = {};
+
+    if (block->memory == 0 || block->length <= 0)
+        return result;
+
+    while (result.bytes < block->length) {
+        isize length = PAX_MIN(block->length - result.bytes, FILE_READ_CHUNK);
+
+        ssize_t bytes = read(self->handle, block->memory + result.bytes,
+            (size_t)(length));
+
+        if (bytes < 0 && errno == EINTR) continue;
+
+        if (bytes < 0) {
+            result.error = FILE_ERROR_UNKNOWN;
+
+            break;
+        }
+
+        result.bytes += (isize)(bytes);
+
+        if (bytes < length) break;
+    }
+
+    return result;
+}
+
+File_Result file_seek_impl(File_Impl* self, isize offset, File_Origin origin)
+{
+    File_Result result = {};
+
+    int method = 0;
+
+    switch (origin) {
+        case FILE_ORIGIN_BEGIN:  { method = SEEK_SET; } break;
+        case FILE_ORIGIN_CURSOR: { method = SEEK_CUR; } break;
+        case FILE_ORIGIN_END:    { method = SEEK_END; } break;
+
+        default: { result.error = FILE_ERROR_ORIGIN_INVALID; } break;
+    }
+
+    if (result.error != FILE_ERROR_NONE) return result;
+
+    off_t position = lseek(self->handle, offset, method);
+
+    if (position >= 0) result.bytes = (isize)(position);
+    else               result.error = FILE_ERROR_UNKNOWN;
+
+    return result;
+}
+
+} // namespace pax
@@ -14,6 +14,12 @@ namespace pax {
 
 struct File_Impl { HANDLE handle; };
 
+//
+// Values
+//
+
+static const isize FILE_READ_CHUNK = 1 << 30;
+
 //
 // Procs
 //
@@ -27,25 +33,106 @@ isize system_get_page_size_impl()
     return info.dwPageSize;
 }
 
+isize system_get_large_page_size_impl()
+{
+    return (isize)(GetLargePageMinimum());
+}
+
 Mem_Block system_reserve_impl(isize pages)
 {
     Mem_Block result = {};
 
-    DWORD length = pages * system_get_page_size();
+    isize page = system_get_page_size();
+
+    if (pages <= 0 || pages > PAX_ISIZE_MAX / page)
+        return result;
+
+    SIZE_T length = (SIZE_T)(pages * page);
+
+    LPVOID memory = VirtualAlloc(0, length,
+        MEM_RESERVE, PAGE_NOACCESS);
+
+    if (memory == 0) return result;
+
+    result.memory = (u8*)(memory);
+    result.length = length;
+
+    return result;
+}
+
+static bool system_enable_lock_memory()
+{
+    TOKEN_PRIVILEGES privileges = {};
+
+    HANDLE token = 0;
+
+    BOOL state = OpenProcessToken(GetCurrentProcess(),
+        TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token);
+
+    if (state == 0) return false;
+
+    privileges.PrivilegeCount           = 1;
+    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+    state = LookupPrivilegeValue(0, SE_LOCK_MEMORY_NAME,
+        &privileges.Privileges[0].Luid);
+
+    if (state != 0)
+        state = AdjustTokenPrivileges(token, FALSE, &privileges, 0, 0, 0);
+
+    DWORD error = GetLastError();
+
+    CloseHandle(token);
+
+    return state != 0 && error == ERROR_SUCCESS;
+}
+
+Mem_Block system_acquire_large_impl(isize length, isize* page)
+{
+    Mem_Block result = {};
+
+    static const bool enabled = system_enable_lock_memory();
 
-    if (pages <= 0) return result;
+    if (enabled == false) return result;
 
     LPVOID memory = VirtualAlloc(0, length,
-        MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
 
     if (memory == 0) return result;
 
     result.memory = (u8*)(memory);
     result.length = length;
 
+    if (page != 0) *page = system_get_large_page_size();
+
     return result;
 }
 
+bool system_commit_impl(Mem_Block block)
+{
+    if (block.memory == 0 || block.length <= 0)
+        return false;
+
+    LPVOID memory = VirtualAlloc(block.memory, block.length,
+        MEM_COMMIT, PAGE_READWRITE);
+
+    return memory != 0;
+}
+
+bool system_decommit_impl(Mem_Block block)
+{
+    if (block.memory == 0 || block.length <= 0)
+        return false;
+
+    u64 page  = (u64)(system_get_page_size());
+    u64 start = ((u64)(block.memory) + page - 1) & ~(page - 1);
+    u64 stop  = (u64)(block.memory + block.length) & ~(page - 1);
+
+    if (stop <= start) return true;
+
+    return VirtualFree((LPVOID)(start), (SIZE_T)(stop - start), MEM_DECOMMIT) != 0;
+}
+
 void system_release_impl(Mem_Block block)
 {
     VirtualFree(block.memory, 0, MEM_RELEASE);
@@ -59,16 +146,14 @@ File_Error file_create_impl(File_Impl* self, String_8 filename, Mem_Arena* arena
     DWORD action = CREATE_NEW;
     DWORD share  = FILE_SHARE_READ;
 
-    isize marker = arena->offset;
+    Mem_Scope scratch = {scratch_begin(arena)};
 
-    if (str8_to_utf16(filename, &result, arena) == false)
+    if (str8_to_utf16(filename, &result, scratch.temp.arena) == false)
         return FILE_ERROR_PATH_ENCODING;
 
     HANDLE handle = CreateFileW((wchar_t*)(result.memory),
         access, share, 0, action, FILE_ATTRIBUTE_NORMAL, 0);
 
-    arena_pop(arena, marker);
-
     if (handle != INVALID_HANDLE_VALUE) {
         self->handle = handle;
 
@@ -91,16 +176,14 @@ File_Error file_create_always_impl(File_Impl* self, String_8 filename, Mem_Arena
     DWORD action = CREATE_ALWAYS;
     DWORD share  = FILE_SHARE_READ;
 
-    isize marker = arena->offset;
+    Mem_Scope scratch = {scratch_begin(arena)};
 
-    if (str8_to_utf16(filename, &result, arena) == false)
+    if (str8_to_utf16(filename, &result, scratch.temp.arena) == false)
         return FILE_ERROR_PATH_ENCODING;
 
     HANDLE handle = CreateFileW((wchar_t*)(result.memory),
         access, share, 0, action, FILE_ATTRIBUTE_NORMAL, 0);
 
-    arena_pop(arena, marker);
-
     if (handle != INVALID_HANDLE_VALUE) {
         self->handle = handle;
 
@@ -123,16 +206,14 @@ File_Error file_open_to_read_impl(File_Impl* self, String_8 filename, Mem_Arena*
     DWORD action = OPEN_EXISTING;
     DWORD share  = FILE_SHARE_READ;
 
-    isize marker = arena->offset;
+    Mem_Scope scratch = {scratch_begin(arena)};
 
-    if (str8_to_utf16(filename, &result, arena) == false)
+    if (str8_to_utf16(filename, &result, scratch.temp.arena) == false)
         return FILE_ERROR_PATH_ENCODING;
 
     HANDLE handle = CreateFileW((wchar_t*)(result.memory),
         access, share, 0, action, FILE_ATTRIBUTE_NORMAL, 0);
 
-    arena_pop(arena, marker);
-
     if (handle != INVALID_HANDLE_VALUE) {
         self->handle = handle;
 
@@ -155,16 +236,14 @@ File_Error file_open_to_write_impl(File_Impl* self, String_8 filename, Mem_Arena
     DWORD action = OPEN_EXISTING;
     DWORD share  = FILE_SHARE_READ;
 
-    isize marker = arena->offset;
+    Mem_Scope scratch = {scratch_begin(arena)};
 
-    if (str8_to_utf16(filename, &result, arena) == false)
+    if (str8_to_utf16(filename, &result, scratch.temp.arena) == false)
         return FILE_ERROR_PATH_ENCODING;
 
     HANDLE handle = CreateFileW((wchar_t*)(result.memory),
         access, share, 0, action, FILE_ATTRIBUTE_NORMAL, 0);
 
-    arena_pop(arena, marker);
-
     if (handle != INVALID_HANDLE_VALUE) {
         self->handle = handle;
 
@@ -191,24 +270,28 @@ File_Result file_read_impl(File_Impl* self, Mem_Block* block)
 {
     File_Result result = {};
 
-    DWORD bytes = 0;
-
     if (block->memory == 0 || block->length <= 0)
         return result;
 
-    BOOL state = ReadFile(self->handle, block->memory,
-        block->length, &bytes, 0);
+    while (result.bytes < block->length) {
+        DWORD bytes  = 0;
+        DWORD length = (DWORD)(PAX_MIN(block->length - result.bytes, FILE_READ_CHUNK));
 
-    if (bytes <= block->length && state != 0) {
-        result.bytes = bytes;
+        BOOL state = ReadFile(self->handle, block->memory + result.bytes,
+            length, &bytes, 0);
 
-        return result;
-    }
+        if (state == 0) {
+            if (GetLastError() != ERROR_HANDLE_EOF)
+                result.error = FILE_ERROR_UNKNOWN;
 
-    switch (GetLastError()) {
-        case ERROR_HANDLE_EOF: { result.bytes = bytes; } break;
+            result.bytes += bytes;
+
+            break;
+        }
+
+        result.bytes += bytes;
 
-        default: { result.error = FILE_ERROR_UNKNOWN; } break;
+        if (bytes < length) break;
     }
 
     return result;
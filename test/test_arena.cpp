@@ -0,0 +1,489 @@
+#include <stdio.h>
+
+#include <thread>
+
+#include "../src/pax_defs.hpp"
+#include "../src/pax_base.hpp"
+#include "../src/pax_system.hpp"
+
+using namespace pax;
+
+static isize test_failures = 0;
+static u64   test_state    = 0x9e3779b97f4a7c15;
+
+#define TEST(cond) test_check((cond), #cond, __LINE__)
+
+void test_check(bool cond, const char* text, int line)
+{
+    if (cond == true) return;
+
+    printf("test_arena.cpp:%d: failed '%s'\n", line, text);
+
+    test_failures += 1;
+}
+
+u64 test_random()
+{
+    test_state ^= test_state << 13;
+    test_state ^= test_state >> 7;
+    test_state ^= test_state << 17;
+
+    return test_state;
+}
+
+isize test_range(isize lower, isize upper)
+{
+    return lower + (isize)(test_random() % (u64)(upper - lower + 1));
+}
+
+void test_fill(Mem_Block block, u8 value)
+{
+    for (isize i = 0; i < block.length; i += 1)
+        block.memory[i] = (u8)(value + i);
+}
+
+bool test_is_filled(Mem_Block block, u8 value)
+{
+    for (isize i = 0; i < block.length; i += 1)
+        if (block.memory[i] != (u8)(value + i)) return false;
+
+    return true;
+}
+
+bool test_is_zero(Mem_Block block)
+{
+    for (isize i = 0; i < block.length; i += 1)
+        if (block.memory[i] != 0) return false;
+
+    return true;
+}
+
+void test_arena_align()
+{
+    static u8 memory[16 * 1024];
+
+    isize aligns[] = {1, 8, 64, 128, 256, 4096};
+    isize count    = PAX_ARRAY_ITEMS(aligns);
+
+    Mem_Arena arena = {};
+
+    arena_init(&arena, {memory + 3, PAX_SIZE_OF(memory) - 3});
+
+    for (isize j = 0; j < count; j += 1) {
+        Mem_Block block = arena_push(&arena, 10, aligns[j]);
+
+        TEST(block.memory != 0);
+        TEST((u64)(block.memory) % (u64)(aligns[j]) == 0);
+    }
+
+    arena_init_chain(&arena, 4096, 2, system_acquire, system_release);
+
+    for (isize i = 0; i < 64; i += 1) {
+        for (isize j = 0; j < count; j += 1) {
+            isize     align = aligns[j];
+            Mem_Block block = arena_push(&arena, 40 + i * 24, align);
+
+            TEST(block.memory != 0);
+            TEST((u64)(block.memory) % (u64)(align) == 0);
+        }
+    }
+
+    arena_release(&arena);
+}
+
+void test_arena_init()
+{
+    static u8 memory[4096];
+
+    Mem_Arena arena = {};
+    isize     bytes = PAX_SIZE_OF(Mem_Arena);
+
+    for (isize i = 0; i < bytes; i += 1)
+        PAX_U8_PTR(&arena)[i] = 0xab;
+
+    arena_init(&arena, {memory, PAX_SIZE_OF(memory)});
+
+    TEST(arena.offset == 0 && arena.chunk == 0 && arena.reserve == 0);
+    TEST(arena_push(&arena, 64, 8).memory == memory);
+
+    arena_init_chain(&arena, 4096, 2, system_acquire, system_release);
+
+    TEST(arena_push(&arena, 64, 8).memory != 0);
+
+    arena_release(&arena);
+
+    arena_init_lazy(&arena, {memory, PAX_SIZE_OF(memory)}, 1024, 0);
+
+    TEST(arena.offset == 0 && arena.spare == 0 && arena.committed == 0);
+
+    arena_init(&arena, {memory, PAX_SIZE_OF(memory)});
+    arena_push(&arena, 64, 8);
+    arena_init(&arena, {memory, PAX_SIZE_OF(memory)});
+
+    TEST(arena.offset == 0);
+}
+
+void test_shared_align()
+{
+    static u8 memory[64 * 1024];
+
+    Mem_Shared_Arena shared = {};
+    Mem_Shared_Cache cache  = {};
+
+    shared_arena_init(&shared, {memory + 3, PAX_SIZE_OF(memory) - 3}, 1024);
+    shared_cache_init(&cache, &shared);
+
+    isize aligns[] = {1, 8, 64, 128, 256, 4096};
+    isize count    = PAX_ARRAY_ITEMS(aligns);
+
+    for (isize i = 0; i < 4; i += 1) {
+        for (isize j = 0; j < count; j += 1) {
+            isize     align = aligns[j];
+            Mem_Block block = shared_cache_push(&cache, 40 + i * 24, align);
+
+            TEST(block.memory != 0);
+            TEST((u64)(block.memory) % (u64)(align) == 0);
+        }
+    }
+}
+
+void test_pool()
+{
+    Mem_Arena arena = {};
+    Mem_Pool  pool  = {};
+
+    arena_init_chain(&arena, 4096, 2, system_acquire, system_release);
+
+    TEST(pool_init(&pool, &arena, 40, 128) == true);
+
+    u8* slots[256] = {};
+
+    for (isize i = 0; i < 256; i += 1) {
+        Mem_Block block = pool_push(&pool);
+
+        TEST(block.memory != 0 && block.length == 40);
+        TEST((u64)(block.memory) % 128 == 0);
+
+        slots[i] = block.memory;
+    }
+
+    for (isize i = 1; i < 256; i += 1)
+        TEST(slots[i] != slots[i - 1]);
+
+    Mem_Block other  = arena_push(&arena, 64, 8);
+    isize     offset = arena.offset;
+
+    for (isize i = 0; i < 64; i += 1)
+        other.memory[i] = (u8)(i);
+
+    pool_clear(&pool);
+
+    TEST(arena.offset == offset);
+
+    for (isize i = 0; i < 256; i += 1) {
+        Mem_Block block = pool_push(&pool);
+
+        TEST(block.memory == slots[i]);
+    }
+
+    TEST(arena.offset == offset);
+
+    for (isize i = 0; i < 64; i += 1)
+        TEST(other.memory[i] == (u8)(i));
+
+    arena_release(&arena);
+}
+
+void test_large()
+{
+    Mem_Arena arena = {};
+
+    isize page = 0;
+
+    Mem_Block block = system_acquire_large(1 << 20, &page);
+
+    TEST(block.memory != 0 && block.length >= (1 << 20));
+    TEST(page >= system_get_page_size());
+
+    system_release(block);
+
+    block = system_acquire_large(1 << 20, 0);
+
+    TEST(block.memory != 0 && block.length >= (1 << 20));
+
+    system_release(block);
+
+    arena_init_chain_large(&arena, 1 << 20, 2);
+
+    for (isize i = 0; i < 4; i += 1) {
+        block = arena_push(&arena, 3 << 20, 64);
+
+        TEST(block.memory != 0);
+
+        if (block.memory != 0) {
+            block.memory[0]                = 1;
+            block.memory[block.length - 1] = 1;
+        }
+    }
+
+    arena_release(&arena);
+}
+
+void test_lazy()
+{
+    isize     page  = system_get_page_size();
+    isize     step  = page * 4;
+    Mem_Block block = system_reserve(64);
+    Mem_Arena arena = {};
+
+    TEST(block.memory != 0);
+
+    arena_init_lazy(&arena, block, step, system_commit);
+
+    isize committed = 0;
+    isize count     = 0;
+
+    while (true) {
+        isize     offset = arena.offset;
+        Mem_Block other  = arena_push(&arena, 1000 + count * 37, 8);
+
+        if (other.memory == 0) {
+            TEST(arena.offset == offset);
+
+            break;
+        }
+
+        TEST(test_is_zero(other) == true);
+        TEST(arena.committed >= arena.offset && arena.committed >= committed);
+        TEST(arena.committed % step == 0 || arena.committed == arena.length);
+
+        test_fill(other, (u8)(count));
+
+        committed  = arena.committed;
+        count     += 1;
+    }
+
+    TEST(count > 8 && arena.offset > block.length - step);
+
+    arena_clear(&arena);
+
+    Mem_Block other = arena_push(&arena, page * 8, 8);
+
+    TEST(other.memory == block.memory && test_is_zero(other) == true);
+    TEST(arena.committed == committed);
+
+    system_release(block);
+
+    block = system_reserve(64);
+
+    arena_init_lazy(&arena, block, step, system_commit);
+
+    other = arena_push(&arena, 100, 8);
+
+    test_fill(other, 7);
+
+    other = arena_resize(&arena, other, step * 3, 8);
+
+    TEST(other.memory == block.memory && arena.committed >= step * 3);
+
+    other.length = 100;
+
+    TEST(test_is_filled(other, 7) == true);
+
+    other = arena_resize(&arena, other, block.length + 1, 8);
+
+    TEST(other.memory == 0);
+
+    system_release(block);
+}
+
+void test_resize()
+{
+    Mem_Arena arena = {};
+
+    arena_init_chain(&arena, 4096, 1, system_acquire, system_release);
+
+    Mem_Block block = arena_push(&arena, 100, 8);
+
+    test_fill(block, 1);
+
+    Mem_Block other = arena_resize(&arena, block, 300, 8);
+    isize     start = arena.offset - 300;
+
+    TEST(other.memory == block.memory && other.length == 300);
+
+    other = arena_resize(&arena, other, 50, 8);
+
+    TEST(other.memory == block.memory && arena.offset == start + 50);
+    TEST(test_is_filled(other, 1) == true);
+
+    Mem_Block next = arena_push(&arena, 10, 8);
+
+    test_fill(next, 9);
+
+    block = arena_resize(&arena, other, 20, 8);
+
+    TEST(block.memory == other.memory && block.length == 20);
+
+    block = arena_resize(&arena, other, 400, 8);
+
+    TEST(block.memory != other.memory && block.length == 400);
+    TEST(test_is_filled({block.memory, 50}, 1) == true);
+    TEST(test_is_filled(next, 9) == true);
+
+    arena_clear(&arena);
+
+    for (isize round = 0; round < 64; round += 1) {
+        Mem_Block base = arena_push(&arena, test_range(1, 64), 8);
+        Mem_Block item = arena_push(&arena, 16, 8);
+
+        test_fill(base, 3);
+        test_fill(item, (u8)(round));
+
+        for (isize i = 0; i < 32; i += 1) {
+            isize     bytes = test_range(1, 10000);
+            isize     keep  = PAX_MIN(bytes, item.length);
+            Mem_Block value = arena_resize(&arena, item, bytes, 8);
+
+            TEST(value.memory != 0 && value.length == bytes);
+            TEST(test_is_filled({value.memory, keep}, (u8)(round)) == true);
+
+            if (value.memory == 0) break;
+
+            test_fill(value, (u8)(round));
+
+            item = value;
+        }
+
+        TEST(test_is_filled(base, 3) == true);
+    }
+
+    arena_release(&arena);
+}
+
+void test_heap()
+{
+    static const isize count = 256;
+
+    Mem_Block memory = system_acquire(1 << 20);
+    Mem_Heap  heap   = {};
+
+    TEST(heap_init(&heap, memory) == true);
+
+    Mem_Heap_Stats stats = heap_stats(&heap);
+
+    isize total = stats.free;
+
+    TEST(stats.used == 0 && stats.count == 1 && stats.largest == total);
+
+    isize     aligns[] = {1, 8, 16, 64, 256, 4096};
+    Mem_Block blocks[count] = {};
+
+    for (isize round = 0; round < 20000; round += 1) {
+        isize index = test_range(0, count - 1);
+
+        if (blocks[index].memory != 0) {
+            TEST(test_is_filled(blocks[index], (u8)(index)) == true);
+            TEST(heap_pop(&heap, blocks[index].memory) == true);
+
+            blocks[index] = {};
+
+            continue;
+        }
+
+        isize align = aligns[test_range(0, PAX_ARRAY_ITEMS(aligns) - 1)];
+        isize bytes = test_range(1, 8192);
+
+        Mem_Block block = heap_push(&heap, bytes, align);
+
+        if (block.memory == 0) continue;
+
+        TEST(block.length == bytes && (u64)(block.memory) % (u64)(align) == 0);
+        TEST(test_is_zero(block) == true);
+
+        test_fill(block, (u8)(index));
+
+        blocks[index] = block;
+    }
+
+    for (isize i = 0; i < count; i += 1) {
+        if (blocks[i].memory == 0) continue;
+
+        TEST(test_is_filled(blocks[i], (u8)(i)) == true);
+        TEST(heap_pop(&heap, blocks[i].memory) == true);
+    }
+
+    stats = heap_stats(&heap);
+
+    TEST(stats.used == 0 && stats.count == 1);
+    TEST(stats.free == total && stats.largest == total);
+    TEST(heap_pop(&heap, memory.memory + memory.length) == false);
+
+    system_release(memory);
+}
+
+void test_shared_thread(Mem_Shared_Arena* shared, Mem_Block* blocks, isize count, u8 value)
+{
+    Mem_Shared_Cache cache = {};
+
+    shared_cache_init(&cache, shared);
+
+    for (isize i = 0; i < count; i += 1) {
+        isize bytes = 1 + (i * 7919 + value) % 3000;
+
+        blocks[i] = shared_cache_push(&cache, bytes, 8);
+
+        if (blocks[i].memory != 0)
+            test_fill(blocks[i], (u8)(value + i));
+    }
+}
+
+void test_shared()
+{
+    static const isize threads = 4;
+    static const isize count   = 4000;
+
+    static Mem_Block blocks[threads][count];
+
+    Mem_Block        memory = system_acquire(64 << 20);
+    Mem_Shared_Arena shared = {};
+
+    shared_arena_init(&shared, memory, 4096);
+
+    std::thread workers[threads];
+
+    for (isize i = 0; i < threads; i += 1)
+        workers[i] = std::thread(test_shared_thread, &shared, blocks[i], count, (u8)(i * 61));
+
+    for (isize i = 0; i < threads; i += 1)
+        workers[i].join();
+
+    for (isize i = 0; i < threads; i += 1) {
+        for (isize j = 0; j < count; j += 1) {
+            Mem_Block block = blocks[i][j];
+
+            TEST(block.memory != 0);
+            TEST(block.memory >= memory.memory && block.memory + block.length <= memory.memory + memory.length);
+            TEST(test_is_filled(block, (u8)(i * 61 + j)) == true);
+        }
+    }
+
+    system_release(memory);
+}
+
+int main()
+{
+    test_arena_align();
+    test_arena_init();
+    test_shared_align();
+    test_pool();
+    test_large();
+    test_lazy();
+    test_resize();
+    test_heap();
+    test_shared();
+
+    if (test_failures != 0) return 1;
+
+    printf("test_arena: ok\n");
+}
@@ -0,0 +1,586 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include "../src/pax_defs.hpp"
+#include "../src/pax_base.hpp"
+#include "../src/pax_system.hpp"
+
+using namespace pax;
+
+static isize test_failures = 0;
+static u64   test_state    = 0x9e3779b97f4a7c15;
+
+#define TEST(cond) test_check((cond), #cond, __LINE__)
+
+static const isize TEST_LENGTH = 512;
+static const isize TEST_ROUNDS = 4000;
+
+void test_check(bool cond, const char* text, int line)
+{
+    if (cond == true) return;
+
+    printf("test_text.cpp:%d: failed '%s'\n", line, text);
+
+    test_failures += 1;
+}
+
+u64 test_random()
+{
+    test_state ^= test_state << 13;
+    test_state ^= test_state >> 7;
+    test_state ^= test_state << 17;
+
+    return test_state;
+}
+
+isize test_range(isize lower, isize upper)
+{
+    return lower + (isize)(test_random() % (u64)(upper - lower + 1));
+}
+
+String_8 test_string(u8* memory, isize length, isize letters)
+{
+    String_8 result = {memory, length};
+
+    for (isize i = 0; i < length; i += 1)
+        memory[i] = (u8)('a' + test_range(0, letters - 1));
+
+    return result;
+}
+
+isize test_find(String_8 self, isize index, String_8 value)
+{
+    for (isize i = index; i + value.length <= self.length; i += 1) {
+        String_8 window = {self.memory + i, value.length};
+
+        if (str8_is_equal(window, value) == true) return i;
+    }
+
+    return -1;
+}
+
+isize test_find_any(String_8 self, isize index, String_8 values)
+{
+    for (isize i = index; i < self.length; i += 1) {
+        for (isize j = 0; j < values.length; j += 1)
+            if (self.memory[i] == values.memory[j]) return i;
+    }
+
+    return -1;
+}
+
+void test_init()
+{
+    static u8  memory_8[TEST_LENGTH + 64];
+    static u16 memory_16[TEST_LENGTH + 64];
+    static u32 memory_32[TEST_LENGTH + 64];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        isize start  = test_range(0, 63);
+        isize length = test_range(0, TEST_LENGTH - 1);
+        isize limit  = test_range(0, TEST_LENGTH);
+
+        for (isize i = 0; i < TEST_LENGTH + 64; i += 1) {
+            memory_8[i]  = (u8)(test_range(1, 0xff));
+            memory_16[i] = (u16)(test_range(1, 0xffff));
+            memory_32[i] = (u32)(test_range(1, 0xffffffff));
+        }
+
+        memory_8[start + length]  = 0;
+        memory_16[start + length] = 0;
+        memory_32[start + length] = 0;
+
+        String_8  string_8  = {};
+        String_16 string_16 = {};
+        String_32 string_32 = {};
+
+        bool expect = length <= limit;
+
+        TEST(str8_init(&string_8, memory_8 + start, limit) == expect);
+        TEST(str16_init(&string_16, memory_16 + start, limit) == expect);
+        TEST(str32_init(&string_32, memory_32 + start, limit) == expect);
+
+        if (expect == true) {
+            TEST(string_8.memory == memory_8 + start && string_8.length == length);
+            TEST(string_16.memory == memory_16 + start && string_16.length == length);
+            TEST(string_32.memory == memory_32 + start && string_32.length == length);
+        }
+    }
+}
+
+void test_search()
+{
+    static u8 memory[TEST_LENGTH];
+    static u8 pattern[16];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        isize    letters = test_range(1, 6);
+        String_8 string  = test_string(memory, test_range(0, TEST_LENGTH), letters);
+        String_8 value   = test_string(pattern, test_range(0, 12), letters);
+        String_8 values  = {pattern, PAX_MIN(value.length, test_range(0, 12))};
+
+        isize index = test_range(0, string.length);
+
+        TEST(str8_find(string, index, value) == test_find(string, index, value));
+        TEST(str8_find_any(string, index, values) == test_find_any(string, index, values));
+
+        if (value.length != 0) {
+            String_8 byte = {value.memory, 1};
+
+            TEST(str8_find_byte(string, index, value.memory[0]) == test_find(string, index, byte));
+        }
+
+        TEST(str8_find(string, string.length + 1, value) == -1);
+        TEST(str8_find_byte(string, -1, 'a') == -1);
+    }
+
+    String_8 string = PAX_STR_8("abc");
+
+    TEST(str8_find(string, 1, PAX_STR_8("")) == 1);
+    TEST(str8_find(string, 0, PAX_STR_8("abcd")) == -1);
+    TEST(str8_find_any(string, 0, PAX_STR_8("")) == -1);
+}
+
+void test_split()
+{
+    static u8 memory[TEST_LENGTH];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        String_8 string    = test_string(memory, test_range(0, TEST_LENGTH), 4);
+        String_8 delimiter = PAX_STR_8("ab");
+
+        if (round % 2 == 0) delimiter = PAX_STR_8("c");
+
+        Str8_Split split = {};
+        String_8   value = {};
+
+        str8_split_init(&split, string);
+
+        isize index = 0;
+
+        while (str8_split_next(&split, delimiter, &value) == true) {
+            isize other = test_find(string, index, delimiter);
+
+            if (other < 0) other = string.length;
+
+            TEST(value.memory == string.memory + index && value.length == other - index);
+
+            index = other + delimiter.length;
+        }
+
+        TEST(index > string.length);
+
+        for (isize i = 0; i < string.length; i += 1) {
+            if (memory[i] == 'a') memory[i] = '\n';
+            if (memory[i] == 'b') memory[i] = '\r';
+        }
+
+        str8_split_init(&split, string);
+
+        index = 0;
+
+        while (str8_split_next_line(&split, &value) == true) {
+            isize other = test_find(string, index, PAX_STR_8("\n"));
+
+            if (other < 0) other = string.length;
+
+            isize length = other - index;
+
+            if (length > 0 && string.memory[other - 1] == '\r') length -= 1;
+
+            TEST(value.memory == string.memory + index && value.length == length);
+
+            index = other + 1;
+        }
+
+        TEST(index >= string.length);
+    }
+
+    Str8_Split split = {};
+    String_8   value = {};
+
+    str8_split_init(&split, PAX_STR_8("a\r\n\r\nb"));
+
+    TEST(str8_split_next_line(&split, &value) == true && str8_is_equal(value, PAX_STR_8("a")) == true);
+    TEST(str8_split_next_line(&split, &value) == true && value.length == 0);
+    TEST(str8_split_next_line(&split, &value) == true && str8_is_equal(value, PAX_STR_8("b")) == true);
+    TEST(str8_split_next_line(&split, &value) == false);
+}
+
+void test_hash()
+{
+    static u8 memory[TEST_LENGTH + 64];
+    static u8 other[TEST_LENGTH + 64];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        isize length = test_range(0, TEST_LENGTH);
+        isize start  = test_range(0, 63);
+        isize shift  = test_range(0, 63);
+        u64   seed   = test_random();
+
+        String_8 string = test_string(memory + start, length, 26);
+        String_8 copy   = {other + shift, length};
+
+        for (isize i = 0; i < length; i += 1)
+            copy.memory[i] = string.memory[i];
+
+        Mem_Block block = {copy.memory, copy.length};
+
+        u64 hash = hash_str8(string, seed);
+
+        TEST(hash_str8(copy, seed) == hash);
+        TEST(hash_bytes(copy.memory, copy.length, seed) == hash);
+        TEST(hash_block(block, seed) == hash);
+        TEST(hash_str8(string, seed + 1) != hash);
+
+        if (length != 0) {
+            isize index = test_range(0, length - 1);
+
+            copy.memory[index] ^= (u8)(1 << test_range(0, 7));
+
+            TEST(hash_str8(copy, seed) != hash);
+        }
+    }
+}
+
+void test_intern(Mem_Arena* arena)
+{
+    static const isize count = 20000;
+
+    Intern_Table table = {};
+
+    TEST(intern_init(&table, 16, arena) == true);
+
+    static isize handles[count] = {};
+
+    for (isize i = 0; i < count; i += 1) {
+        u8       buffer[32] = {};
+        isize    length     = snprintf((char*)(buffer), PAX_SIZE_OF(buffer), "key-%lld", (long long)(i * 7919));
+        String_8 string     = {buffer, length};
+
+        handles[i] = intern_insert(&table, string, arena);
+
+        TEST(handles[i] == i + 1);
+        TEST(intern_insert(&table, string, arena) == handles[i]);
+    }
+
+    TEST(table.count == count);
+
+    for (isize i = 0; i < count; i += 1) {
+        u8       buffer[32] = {};
+        isize    length     = snprintf((char*)(buffer), PAX_SIZE_OF(buffer), "key-%lld", (long long)(i * 7919));
+        String_8 string     = {buffer, length};
+        String_8 value      = intern_get(&table, handles[i]);
+
+        TEST(intern_find(&table, string) == handles[i]);
+        TEST(str8_is_equal(value, string) == true && value.memory[length] == 0);
+    }
+
+    TEST(intern_find(&table, PAX_STR_8("key")) == 0);
+    TEST(intern_find(&table, PAX_STR_8("")) == 0);
+    TEST(intern_insert(&table, PAX_STR_8(""), arena) == count + 1);
+    TEST(intern_get(&table, 0).length == 0);
+    TEST(intern_get(&table, count + 2).length == 0);
+}
+
+String_8 test_number(u8* memory, isize minus)
+{
+    String_8 result = {memory, 0};
+
+    if (test_range(0, 3) == 0) {
+        memory[result.length] = '+';
+
+        if (minus != 0 && test_range(0, 1) == 0)
+            memory[result.length] = '-';
+
+        result.length += 1;
+    }
+
+    if (test_range(0, 3) == 0) {
+        isize zeros = test_range(1, 20);
+
+        for (isize i = 0; i < zeros; i += 1)
+            memory[result.length + i] = '0';
+
+        result.length += zeros;
+    }
+
+    isize digits = test_range(0, 24);
+
+    if (test_range(0, 1) == 0) digits = test_range(0, 3);
+
+    for (isize i = 0; i < digits; i += 1)
+        memory[result.length + i] = (u8)('0' + test_range(0, 9));
+
+    result.length += digits;
+
+    memory[result.length + 0] = (u8)(test_range(0, 1) == 0 ? 'z' : '.');
+    memory[result.length + 1] = 0;
+
+    return result;
+}
+
+void test_parse_int()
+{
+    static u8 memory[64];
+
+    for (isize round = 0; round < TEST_ROUNDS * 4; round += 1) {
+        String_8 string = test_number(memory, 0);
+        String_8 input  = {string.memory, string.length + 1};
+        char*    stop   = 0;
+
+        errno = 0;
+
+        u64 expect = strtoull((char*)(memory), &stop, 10);
+        int error  = errno;
+
+        Parse_U64 parse = str8_parse_u64(input, 0);
+
+        if ((u8*)(stop) == memory) {
+            TEST(parse.error == PARSE_ERROR_INVALID);
+        } else {
+            TEST(parse.units == (u8*)(stop) - memory && parse.value == expect);
+            TEST(parse.error == (error == ERANGE ? PARSE_ERROR_OVERFLOW : PARSE_ERROR_NONE));
+        }
+    }
+
+    for (isize round = 0; round < TEST_ROUNDS * 4; round += 1) {
+        String_8 string = test_number(memory, 1);
+        String_8 input  = {string.memory, string.length + 1};
+        char*    stop   = 0;
+
+        errno = 0;
+
+        i64 expect = strtoll((char*)(memory), &stop, 10);
+        int error  = errno;
+
+        Parse_I64 parse = str8_parse_i64(input, 0);
+
+        if ((u8*)(stop) == memory) {
+            TEST(parse.error == PARSE_ERROR_INVALID);
+        } else {
+            TEST(parse.units == (u8*)(stop) - memory && parse.value == expect);
+            TEST(parse.error == (error == ERANGE ? PARSE_ERROR_OVERFLOW : PARSE_ERROR_NONE));
+        }
+    }
+
+    TEST(str8_parse_u64(PAX_STR_8("18446744073709551615"), 0).error == PARSE_ERROR_NONE);
+    TEST(str8_parse_u64(PAX_STR_8("18446744073709551616"), 0).error == PARSE_ERROR_OVERFLOW);
+    TEST(str8_parse_u64(PAX_STR_8("+7"), 0).value == 7);
+    TEST(str8_parse_u64(PAX_STR_8("+"), 0).error == PARSE_ERROR_INVALID);
+    TEST(str8_parse_u64(PAX_STR_8("-1"), 0).error == PARSE_ERROR_INVALID);
+    TEST(str8_parse_u64(PAX_STR_8("1"), 2).error == PARSE_ERROR_OUT_OF_BOUNDS);
+    TEST(str8_parse_i64(PAX_STR_8("-9223372036854775808"), 0).error == PARSE_ERROR_NONE);
+    TEST(str8_parse_i64(PAX_STR_8("9223372036854775808"), 0).error == PARSE_ERROR_OVERFLOW);
+    TEST(str8_parse_i64(PAX_STR_8("+-1"), 0).error == PARSE_ERROR_INVALID);
+}
+
+void test_parse_f64()
+{
+    static const char* cases[] = {
+        "0", "-0", "0.0", ".5", "5.", "1e", "1e+", "1e-5x", "4.9e-324", "2.4703282292062328e-324",
+        "2.4703282292062327e-324", "1.7976931348623157e308", "1.7976931348623159e308", "1e400",
+        "1e-400", "9007199254740993", "0.1", "123456789012345678901234567890", "2.2250738585072011e-308",
+        "0.000000000000000000000000000000000000000000001", "inf", "-Infinity", "1e99999999999",
+    };
+
+    static char memory[64];
+
+    isize count = PAX_ARRAY_ITEMS(cases);
+
+    for (isize i = 0; i < count; i += 1) {
+        String_8 string = {(u8*)(cases[i]), 0};
+
+        while (cases[i][string.length] != 0)
+            string.length += 1;
+
+        char* stop   = 0;
+        f64   expect = strtod(cases[i], &stop);
+
+        Parse_F64 parse = str8_parse_f64(string, 0);
+
+        TEST(parse.units == stop - cases[i]);
+        TEST(bits_from_f64(parse.value) == bits_from_f64(expect));
+    }
+
+    TEST(str8_parse_f64(PAX_STR_8("."), 0).error == PARSE_ERROR_INVALID);
+    TEST(str8_parse_f64(PAX_STR_8("-"), 0).error == PARSE_ERROR_INVALID);
+
+    for (isize round = 0; round < TEST_ROUNDS * 16; round += 1) {
+        u64 bits = test_random();
+
+        if (((bits >> 52) & 0x7ff) == 0x7ff) continue;
+
+        f64   value  = bits_to_f64(bits);
+        isize length = 0;
+
+        switch (round % 4) {
+            case 0: length = snprintf(memory, PAX_SIZE_OF(memory), "%.17g", value); break;
+            case 1: length = snprintf(memory, PAX_SIZE_OF(memory), "%.*e", (int)(test_range(0, 20)), value); break;
+            case 2: length = snprintf(memory, PAX_SIZE_OF(memory), "%.*g", (int)(test_range(1, 17)), value); break;
+
+            case 3: {
+                String_8 string = test_number((u8*)(memory), 1);
+
+                length = string.length + 1;
+
+                if (memory[string.length] == '.') {
+                    isize digits = test_range(0, 24);
+
+                    for (isize i = 0; i < digits; i += 1)
+                        memory[length + i] = (char)('0' + test_range(0, 9));
+
+                    length += digits;
+                }
+
+                memory[length] = 0;
+
+                if (test_range(0, 1) == 0)
+                    length += snprintf(memory + length, PAX_SIZE_OF(memory) - length, "e%d", (int)(test_range(-340, 320)));
+            } break;
+        }
+
+        String_8 string = {(u8*)(memory), length};
+        char*    stop   = 0;
+        f64      expect = strtod(memory, &stop);
+
+        Parse_F64 parse = str8_parse_f64(string, 0);
+
+        if (stop == memory) {
+            TEST(parse.error == PARSE_ERROR_INVALID);
+        } else {
+            TEST(parse.units == stop - memory);
+            TEST(bits_from_f64(parse.value) == bits_from_f64(expect));
+        }
+    }
+}
+
+isize test_significant(String_8 string)
+{
+    isize first = -1;
+    isize last  = -1;
+
+    for (isize i = 0; i < string.length && string.memory[i] != 'e'; i += 1) {
+        u8 value = string.memory[i];
+
+        if (value < '1' || value > '9') continue;
+
+        if (first < 0) first = i;
+
+        last = i;
+    }
+
+    isize result = 0;
+
+    for (isize i = first; first >= 0 && i <= last; i += 1) {
+        if (string.memory[i] != '.') result += 1;
+    }
+
+    return result;
+}
+
+void test_format(Mem_Arena* arena)
+{
+    static char memory[64];
+
+    for (isize round = 0; round < TEST_ROUNDS * 4; round += 1) {
+        isize marker = arena->offset;
+        u64   bits   = test_random();
+        u64   value  = bits >> test_range(0, 63);
+        isize digits = test_range(0, 20);
+
+        Str8_Builder builder = {};
+
+        str8_builder_init(&builder, arena);
+
+        TEST(str8_builder_push_u64(&builder, value) == true);
+        TEST(str8_builder_push_str8(&builder, PAX_STR_8(" ")) == true);
+        TEST(str8_builder_push_i64(&builder, (i64)(value)) == true);
+        TEST(str8_builder_push_str8(&builder, PAX_STR_8(" ")) == true);
+        TEST(str8_builder_push_hex(&builder, value, digits) == true);
+
+        isize    length = snprintf(memory, PAX_SIZE_OF(memory), "%llu %lld %0*llx",
+            (unsigned long long)(value), (long long)(value), (int)(digits), (unsigned long long)(value));
+        String_8 expect = {(u8*)(memory), length};
+
+        TEST(str8_is_equal(str8_builder_finish(&builder), expect) == true);
+
+        arena_pop(arena, marker);
+
+        if (((bits >> 52) & 0x7ff) == 0x7ff) continue;
+
+        f64 number = bits_to_f64(bits);
+
+        if (round % 2 == 0)
+            number = (f64)(test_range(-1000000, 1000000)) / (f64)(1 << test_range(0, 20));
+
+        str8_builder_init(&builder, arena);
+
+        TEST(str8_builder_push_f64(&builder, number) == true);
+
+        String_8 string = str8_builder_finish(&builder);
+        isize    places = 1;
+
+        for (isize i = 0; i < string.length; i += 1)
+            memory[i] = (char)(string.memory[i]);
+
+        memory[string.length] = 0;
+
+        TEST(bits_from_f64(strtod(memory, 0)) == bits_from_f64(number));
+
+        while (places < 17) {
+            char other[64] = {};
+
+            snprintf(other, PAX_SIZE_OF(other), "%.*e", (int)(places - 1), number);
+
+            if (strtod(other, 0) == number) break;
+
+            places += 1;
+        }
+
+        if (number != 0) TEST(test_significant(string) == places);
+
+        arena_pop(arena, marker);
+    }
+
+    static const f64 cases[]  = {0.0, -0.0, 1.0, -1.5, 100.0, 1e21, 1e22, 0.1, 1e-7, 5e-324, 1.7976931348623157e308};
+    static const char* text[] = {"0", "-0", "1", "-1.5", "100", "1e+21", "1e+22", "0.1", "1e-7", "5e-324", "1.7976931348623157e+308"};
+
+    isize count = PAX_ARRAY_ITEMS(cases);
+
+    for (isize i = 0; i < count; i += 1) {
+        Str8_Builder builder = {};
+        String_8     expect  = {(u8*)(text[i]), 0};
+
+        while (text[i][expect.length] != 0)
+            expect.length += 1;
+
+        str8_builder_init(&builder, arena);
+
+        TEST(str8_builder_push_f64(&builder, cases[i]) == true);
+        TEST(str8_is_equal(str8_builder_finish(&builder), expect) == true);
+    }
+}
+
+int main()
+{
+    Mem_Arena arena = {};
+
+    arena_init_chain(&arena, 64 * 1024, 2, system_acquire, system_release);
+
+    test_init();
+    test_search();
+    test_split();
+    test_hash();
+    test_intern(&arena);
+    test_parse_int();
+    test_parse_f64();
+    test_format(&arena);
+
+    arena_release(&arena);
+
+    if (test_failures != 0) return 1;
+
+    printf("test_text: ok\n");
+}
@@ -0,0 +1,597 @@
+#include <stdio.h>
+
+#include "../src/pax_defs.hpp"
+#include "../src/pax_base.hpp"
+#include "../src/pax_system.hpp"
+
+using namespace pax;
+
+static isize test_failures = 0;
+static u64   test_state    = 0x9e3779b97f4a7c15;
+
+#define TEST(cond) test_check((cond), #cond, __LINE__)
+
+static const isize TEST_LENGTH = 512;
+static const isize TEST_ROUNDS = 4000;
+
+static const String_8 TEST_BROKEN[] = {
+    PAX_STR_8("\xc0\x80"),
+    PAX_STR_8("\xc1\xbf"),
+    PAX_STR_8("\xe0\x80\x80"),
+    PAX_STR_8("\xe0\x9f\xbf"),
+    PAX_STR_8("\xf0\x80\x80\x80"),
+    PAX_STR_8("\xf0\x8f\xbf\xbf"),
+    PAX_STR_8("\xed\xa0\x80"),
+    PAX_STR_8("\xed\xbf\xbf"),
+    PAX_STR_8("\xf4\x90\x80\x80"),
+    PAX_STR_8("\xf5\x80\x80\x80"),
+    PAX_STR_8("\xff"),
+    PAX_STR_8("\x80"),
+    PAX_STR_8("\xbf\xbf"),
+    PAX_STR_8("\xc3"),
+    PAX_STR_8("\xe4\xb8"),
+    PAX_STR_8("\xf0\x9f\x98"),
+};
+
+void test_check(bool cond, const char* text, int line)
+{
+    if (cond == true) return;
+
+    printf("test_utf.cpp:%d: failed '%s'\n", line, text);
+
+    test_failures += 1;
+}
+
+u64 test_random()
+{
+    test_state ^= test_state << 13;
+    test_state ^= test_state >> 7;
+    test_state ^= test_state << 17;
+
+    return test_state;
+}
+
+isize test_range(isize lower, isize upper)
+{
+    return lower + (isize)(test_random() % (u64)(upper - lower + 1));
+}
+
+u32 test_point()
+{
+    switch (test_range(0, 9)) {
+        case 0: case 1: case 2: case 3: case 4:
+            return (u32)(test_range(0x20, 0x7e));
+
+        case 5: case 6:
+            return (u32)(test_range(0x80, 0x7ff));
+
+        case 7: {
+            u32 value = (u32)(test_range(0x800, 0xfffd));
+
+            if (unicode_is_surr_any(value) == true || unicode_is_surr_high(value) == true)
+                value = 0xe000;
+
+            return value;
+        }
+    }
+
+    return (u32)(test_range(0x10000, 0x10ffff));
+}
+
+String_8 test_utf8(u8* memory, isize errors)
+{
+    String_8 result = {memory, 0};
+    String_8 buffer = {memory, TEST_LENGTH};
+
+    isize length = test_range(0, TEST_LENGTH - 8);
+
+    while (result.length < length) {
+        if (errors != 0 && test_range(0, 40) == 0) {
+            String_8 broken = TEST_BROKEN[test_range(0, PAX_ARRAY_ITEMS(TEST_BROKEN) - 1)];
+
+            for (isize i = 0; i < broken.length; i += 1)
+                memory[result.length + i] = broken.memory[i];
+
+            result.length += broken.length;
+
+            continue;
+        }
+
+        if (test_range(0, 3) == 0) {
+            isize count = test_range(1, 48);
+
+            for (isize i = 0; i < count && result.length < length; i += 1) {
+                memory[result.length] = (u8)(test_range(0x20, 0x7e));
+
+                result.length += 1;
+            }
+
+            continue;
+        }
+
+        result.length += str8_encode(buffer, result.length, test_point()).units;
+    }
+
+    if (errors != 0 && test_range(0, 3) == 0)
+        result.length = test_range(0, result.length);
+
+    return result;
+}
+
+UTF_Result test_utf8_decode(String_8 self, isize index)
+{
+    UTF_Result result = {};
+
+    u32   value  = 0;
+    u8*   memory = self.memory + index;
+    isize units  = utf8_get_units_ahead(memory[0]);
+
+    if (index + units > self.length)
+        result.error = UTF_ERROR_OUT_OF_BOUNDS;
+
+    for (isize i = 1; i < units && index + i < self.length; i += 1) {
+        if (utf8_is_trailing(memory[i]) == false)
+            result.error = UTF_ERROR_INVALID;
+    }
+
+    if (result.error != UTF_ERROR_NONE) return result;
+
+    switch (units) {
+        case 1: { value = memory[0]; } break;
+
+        case 2: {
+            value  = (memory[0] & 0x1f) << 6;
+            value += (memory[1] & 0x3f);
+        } break;
+
+        case 3: {
+            value  = (memory[0] & 0x0f) << 12;
+            value += (memory[1] & 0x3f) <<  6;
+            value += (memory[2] & 0x3f);
+        } break;
+
+        case 4: {
+            value  = (memory[0] & 0x07) << 18;
+            value += (memory[1] & 0x3f) << 12;
+            value += (memory[2] & 0x3f) <<  6;
+            value += (memory[3] & 0x3f);
+        } break;
+
+        default: { result.error = UTF_ERROR_UNREACHABLE; } break;
+    }
+
+    if (utf8_is_overlong(value, units) == true)
+        result.error = UTF_ERROR_OVERLONG;
+
+    if (unicode_is_surr_any(value) == true)
+        result.error = UTF_ERROR_SURROGATE;
+
+    if (unicode_is_invalid(value) == true)
+        result.error = UTF_ERROR_INVALID;
+
+    result.value = value;
+    result.units = units;
+
+    return result;
+}
+
+UTF_Check test_utf8_points(String_8 self, String_32* points)
+{
+    UTF_Check result = {};
+
+    isize index = 0;
+
+    points->length = 0;
+
+    while (index < self.length) {
+        UTF_Result decode = test_utf8_decode(self, index);
+
+        if (decode.error != UTF_ERROR_NONE) {
+            result.error  = decode.error;
+            result.offset = index;
+
+            return result;
+        }
+
+        points->memory[points->length] = decode.value;
+
+        points->length += 1;
+        index          += decode.units;
+    }
+
+    result.offset = index;
+
+    return result;
+}
+
+String_16 test_utf16(String_32 points, u16* memory)
+{
+    String_16 result = {memory, TEST_LENGTH * 2};
+
+    isize index = 0;
+
+    for (isize i = 0; i < points.length; i += 1)
+        index += str16_encode(result, index, points.memory[i]).units;
+
+    result.length = index;
+
+    return result;
+}
+
+String_8 test_utf8_encode(String_32 points, u8* memory)
+{
+    String_8 result = {memory, TEST_LENGTH};
+
+    isize index = 0;
+
+    for (isize i = 0; i < points.length; i += 1)
+        index += str8_encode(result, index, points.memory[i]).units;
+
+    result.length = index;
+
+    return result;
+}
+
+bool test_is_equal_16(String_16 self, String_16 value)
+{
+    if (self.length != value.length) return false;
+
+    for (isize i = 0; i < self.length; i += 1) {
+        if (self.memory[i] != value.memory[i]) return false;
+    }
+
+    return true;
+}
+
+bool test_is_equal_32(String_32 self, String_32 value)
+{
+    if (self.length != value.length) return false;
+
+    for (isize i = 0; i < self.length; i += 1) {
+        if (self.memory[i] != value.memory[i]) return false;
+    }
+
+    return true;
+}
+
+void test_decode()
+{
+    static u8 memory[TEST_LENGTH];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        String_8 string = test_utf8(memory, 1);
+
+        for (isize i = 0; i < string.length; i += 1) {
+            UTF_Result decode = str8_decode(string, i);
+            UTF_Result expect = test_utf8_decode(string, i);
+
+            TEST(decode.error == expect.error);
+
+            if (expect.error == UTF_ERROR_NONE)
+                TEST(decode.value == expect.value && decode.units == expect.units);
+        }
+    }
+
+    String_8 empty = {};
+
+    TEST(str8_decode(empty, 0).error == UTF_ERROR_OUT_OF_BOUNDS);
+    TEST(str8_decode(PAX_STR_8("a"), -1).error == UTF_ERROR_OUT_OF_BOUNDS);
+    TEST(str8_decode(PAX_STR_8("\xed\xa0\x80"), 0).error != UTF_ERROR_NONE);
+    TEST(str8_decode(PAX_STR_8("\xf4\x90\x80\x80"), 0).error != UTF_ERROR_NONE);
+    TEST(str8_decode(PAX_STR_8("\xe4\xb8"), 0).error == UTF_ERROR_OUT_OF_BOUNDS);
+    TEST(str8_decode(PAX_STR_8("\xf4\x8f\xbf\xbf"), 0).value == 0x10ffff);
+}
+
+void test_validate()
+{
+    static u8  memory[TEST_LENGTH];
+    static u32 values[TEST_LENGTH];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        String_8  string = test_utf8(memory, round % 2);
+        String_32 points = {values, 0};
+        UTF_Check expect = test_utf8_points(string, &points);
+        UTF_Check check  = str8_validate(string);
+
+        TEST(check.error == expect.error && check.offset == expect.offset);
+
+        isize units = 0;
+
+        for (isize i = 0; i < points.length; i += 1)
+            units += utf16_get_units(points.memory[i]);
+
+        if (expect.error != UTF_ERROR_NONE) {
+            units         = -1;
+            points.length = -1;
+        }
+
+        TEST(str8_count_as_utf16(string) == units);
+        TEST(str8_count_as_utf32(string) == points.length);
+    }
+}
+
+void test_convert(Mem_Arena* arena)
+{
+    static u8  memory[TEST_LENGTH];
+    static u8  copy[TEST_LENGTH];
+    static u16 buffer[TEST_LENGTH * 2];
+    static u32 values[TEST_LENGTH];
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        String_8  string = test_utf8(memory, round % 2);
+        String_32 points = {values, 0};
+        UTF_Check expect = test_utf8_points(string, &points);
+
+        String_16 utf16 = {};
+        String_32 utf32 = {};
+        String_8  utf8  = {};
+
+        isize marker = arena->offset;
+
+        if (expect.error != UTF_ERROR_NONE) {
+            TEST(str8_to_utf16(string, &utf16, arena) == false);
+            TEST(str8_to_utf32(string, &utf32, arena) == false);
+            TEST(arena->offset == marker);
+
+            continue;
+        }
+
+        String_8  canon = test_utf8_encode(points, copy);
+        String_16 other = test_utf16(points, buffer);
+
+        TEST(str8_to_utf32(string, &utf32, arena) == true);
+        TEST(test_is_equal_32(utf32, points) == true);
+        TEST(utf32.memory[utf32.length] == 0);
+
+        TEST(str8_to_utf16(string, &utf16, arena) == true);
+        TEST(test_is_equal_16(utf16, other) == true);
+        TEST(utf16.memory[utf16.length] == 0);
+
+        TEST(str16_count_as_utf8(utf16) == canon.length);
+        TEST(str16_count_as_utf32(utf16) == points.length);
+        TEST(str32_count_as_utf8(utf32) == canon.length);
+        TEST(str32_count_as_utf16(utf32) == other.length);
+
+        TEST(str16_to_utf8(utf16, &utf8, arena) == true);
+        TEST(str8_is_equal(utf8, canon) == true);
+
+        TEST(str32_to_utf8(utf32, &utf8, arena) == true);
+        TEST(str8_is_equal(utf8, canon) == true);
+
+        String_16 again_16 = {};
+        String_32 again_32 = {};
+
+        TEST(str16_to_utf32(utf16, &again_32, arena) == true);
+        TEST(test_is_equal_32(again_32, points) == true);
+
+        TEST(str32_to_utf16(utf32, &again_16, arena) == true);
+        TEST(test_is_equal_16(again_16, other) == true);
+
+        if (other.length != 0) {
+            isize index = test_range(0, other.length - 1);
+            u16   value = other.memory[index];
+
+            other.memory[index] = (u16)(test_range(0xd800, 0xdfff));
+
+            bool valid = true;
+
+            for (isize i = 0; i < other.length; i += 1) {
+                UTF_Result decode = str16_decode(other, i);
+
+                if (decode.error != UTF_ERROR_NONE) {
+                    valid = false;
+
+                    break;
+                }
+
+                i += decode.units - 1;
+            }
+
+            isize marker_16 = arena->offset;
+
+            TEST(str16_to_utf8(other, &utf8, arena) == valid);
+            TEST((str16_count_as_utf8(other) >= 0) == valid);
+
+            if (valid == false)
+                TEST(arena->offset == marker_16);
+
+            other.memory[index] = value;
+        }
+
+        arena_pop(arena, marker);
+    }
+}
+
+void test_stream(Mem_Arena* arena)
+{
+    static u8  memory[TEST_LENGTH];
+    static u16 buffer_16[TEST_LENGTH * 2];
+    static u32 buffer_32[TEST_LENGTH];
+
+    for (isize round = 0; round < TEST_ROUNDS / 4; round += 1) {
+        String_8  string = test_utf8(memory, 0);
+        String_16 whole  = {};
+        String_32 points = {};
+
+        isize marker = arena->offset;
+
+        TEST(str8_to_utf16(string, &whole, arena) == true);
+        TEST(str8_to_utf32(string, &points, arena) == true);
+
+        UTF8_Stream stream_16 = {};
+        UTF8_Stream stream_32 = {};
+
+        isize index = 0;
+        isize count = 0;
+        isize other = 0;
+
+        while (index < string.length) {
+            isize length = test_range(0, 9);
+
+            length = PAX_MIN(length, string.length - index);
+
+            if (test_range(0, 7) == 0)
+                length = string.length - index;
+
+            String_8  chunk = {string.memory + index, length};
+            String_16 part  = {};
+            String_32 piece = {};
+
+            TEST(utf8_stream_to_utf16(&stream_16, chunk, &part, arena) == true);
+            TEST(utf8_stream_to_utf32(&stream_32, chunk, &piece, arena) == true);
+
+            for (isize i = 0; i < part.length; i += 1)
+                buffer_16[count + i] = part.memory[i];
+
+            for (isize i = 0; i < piece.length; i += 1)
+                buffer_32[other + i] = piece.memory[i];
+
+            count += part.length;
+            other += piece.length;
+            index += length;
+        }
+
+        String_16 joined_16 = {buffer_16, count};
+        String_32 joined_32 = {buffer_32, other};
+
+        TEST(test_is_equal_16(joined_16, whole) == true);
+        TEST(test_is_equal_32(joined_32, points) == true);
+        TEST(utf8_stream_finish(&stream_16) == true);
+        TEST(utf8_stream_finish(&stream_32) == true);
+
+        arena_pop(arena, marker);
+    }
+
+    UTF8_Stream stream = {};
+    String_32   result = {};
+
+    TEST(utf8_stream_to_utf32(&stream, PAX_STR_8("a\xe4\xb8"), &result, arena) == true);
+    TEST(result.length == 1 && stream.count == 2);
+    TEST(utf8_stream_finish(&stream) == false);
+
+    TEST(utf8_stream_to_utf32(&stream, PAX_STR_8("A"), &result, arena) == false);
+    TEST(stream.count == 2);
+
+    TEST(utf8_stream_to_utf32(&stream, PAX_STR_8("\xad!"), &result, arena) == true);
+    TEST(result.length == 2 && result.memory[0] == 0x4e2d && result.memory[1] == '!');
+    TEST(utf8_stream_finish(&stream) == true);
+}
+
+void test_batch()
+{
+    static u8  memory[TEST_LENGTH];
+    static u8  copy[TEST_LENGTH];
+    static u32 values[TEST_LENGTH];
+    static u32 output[TEST_LENGTH];
+
+    isize sizes[] = {1, 3, 17, 40, TEST_LENGTH};
+    isize count   = PAX_ARRAY_ITEMS(sizes);
+
+    for (isize round = 0; round < TEST_ROUNDS; round += 1) {
+        String_8  string = test_utf8(memory, round % 2);
+        String_32 points = {values, 0};
+        UTF_Check expect = test_utf8_points(string, &points);
+
+        isize size  = sizes[round % count];
+        isize index = 0;
+        isize other = 0;
+
+        UTF_Batch batch = {};
+
+        while (index < string.length) {
+            String_32 buffer = {output + other, PAX_MIN(size, TEST_LENGTH - other)};
+
+            batch = str8_decode_many(string, index, buffer);
+
+            index += batch.consumed;
+            other += batch.produced;
+
+            if (batch.error != UTF_ERROR_NONE) break;
+        }
+
+        String_32 result = {output, other};
+
+        if (expect.error == UTF_ERROR_NONE) {
+            TEST(batch.error == UTF_ERROR_NONE);
+            TEST(test_is_equal_32(result, points) == true);
+
+            static u8 bytes[TEST_LENGTH];
+
+            String_8 canon  = test_utf8_encode(points, bytes);
+            String_8 target = {copy, canon.length};
+
+            UTF_Batch encode = str8_encode_many(target, 0, points);
+
+            TEST(encode.error == UTF_ERROR_NONE && encode.consumed == points.length);
+            TEST(encode.produced == canon.length && str8_is_equal(target, canon) == true);
+        } else {
+            TEST(batch.error != UTF_ERROR_NONE && index == expect.offset);
+            TEST(test_is_equal_32(result, points) == true);
+        }
+    }
+}
+
+void test_index(Mem_Arena* arena)
+{
+    static u8    memory[TEST_LENGTH];
+    static isize points[TEST_LENGTH + 1];
+
+    isize steps[] = {1, 2, 7, 16, 64};
+    isize count   = PAX_ARRAY_ITEMS(steps);
+
+    for (isize round = 0; round < TEST_ROUNDS / 4; round += 1) {
+        String_8 string = test_utf8(memory, 0);
+
+        isize marker = arena->offset;
+        isize point  = 0;
+
+        for (isize i = 0; i < string.length; i += 1) {
+            if (utf8_is_trailing(string.memory[i]) == false)
+                point += 1;
+
+            points[i] = point - 1;
+        }
+
+        points[string.length] = point;
+
+        UTF8_Index index = {};
+
+        String_8 prefix = {string.memory, test_range(0, string.length)};
+
+        TEST(utf8_index_init(&index, prefix, steps[round % count], arena) == true);
+        TEST(utf8_index_append(&index, string, arena) == true);
+        TEST(index.points == point && index.length == string.length);
+
+        for (isize i = 0; i <= string.length; i += 1) {
+            TEST(utf8_index_to_point(&index, string, i) == points[i]);
+
+            if (i == string.length || utf8_is_trailing(string.memory[i]) == false)
+                TEST(utf8_index_to_offset(&index, string, points[i]) == i);
+        }
+
+        TEST(utf8_index_to_offset(&index, string, point + 1) == -1);
+        TEST(utf8_index_to_point(&index, string, string.length + 1) == -1);
+
+        arena_pop(arena, marker);
+    }
+}
+
+int main()
+{
+    Mem_Arena arena = {};
+
+    arena_init_chain(&arena, 64 * 1024, 2, system_acquire, system_release);
+
+    test_decode();
+    test_validate();
+    test_convert(&arena);
+    test_stream(&arena);
+    test_batch();
+    test_index(&arena);
+
+    arena_release(&arena);
+
+    if (test_failures != 0) return 1;
+
+    printf("test_utf: ok\n");
+}